@@ -5,17 +5,32 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Src/image_codec.c \
 ../Src/main.c \
+../Src/point_ops.c \
+../Src/point_ops_pwl.c \
+../Src/point_ops_simd.c \
+../Src/stack_monitor.c \
 ../Src/syscalls.c \
 ../Src/sysmem.c 
 
 OBJS += \
+./Src/image_codec.o \
 ./Src/main.o \
+./Src/point_ops.o \
+./Src/point_ops_pwl.o \
+./Src/point_ops_simd.o \
+./Src/stack_monitor.o \
 ./Src/syscalls.o \
 ./Src/sysmem.o 
 
 C_DEPS += \
+./Src/image_codec.d \
 ./Src/main.d \
+./Src/point_ops.d \
+./Src/point_ops_pwl.d \
+./Src/point_ops_simd.d \
+./Src/stack_monitor.d \
 ./Src/syscalls.d \
 ./Src/sysmem.d 
 
@@ -27,7 +42,7 @@ Src/%.o Src/%.su Src/%.cyclo: ../Src/%.c Src/subdir.mk
 clean: clean-Src
 
 clean-Src:
-	-$(RM) ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su
+	-$(RM) ./Src/image_codec.cyclo ./Src/image_codec.d ./Src/image_codec.o ./Src/image_codec.su ./Src/main.cyclo ./Src/main.d ./Src/main.o ./Src/main.su ./Src/point_ops.cyclo ./Src/point_ops.d ./Src/point_ops.o ./Src/point_ops.su ./Src/point_ops_pwl.cyclo ./Src/point_ops_pwl.d ./Src/point_ops_pwl.o ./Src/point_ops_pwl.su ./Src/point_ops_simd.cyclo ./Src/point_ops_simd.d ./Src/point_ops_simd.o ./Src/point_ops_simd.su ./Src/stack_monitor.cyclo ./Src/stack_monitor.d ./Src/stack_monitor.o ./Src/stack_monitor.su ./Src/syscalls.cyclo ./Src/syscalls.d ./Src/syscalls.o ./Src/syscalls.su ./Src/sysmem.cyclo ./Src/sysmem.d ./Src/sysmem.o ./Src/sysmem.su
 
 .PHONY: clean-Src
 
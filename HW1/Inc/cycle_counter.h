@@ -0,0 +1,44 @@
+/*
+ * cycle_counter.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef CYCLE_COUNTER_H_
+#define CYCLE_COUNTER_H_
+
+#include <stdint.h>
+
+/*
+ * This project has no CMSIS/HAL, so the few Cortex-M4 core registers we need
+ * for benchmarking are addressed directly (ARMv7-M ARM, C1.8 and B3.2).
+ */
+#define CPACR      (*(volatile uint32_t *)0xE000ED88u)
+#define DEMCR      (*(volatile uint32_t *)0xE000EDFCu)
+#define DWT_CTRL   (*(volatile uint32_t *)0xE0001000u)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004u)
+
+#define DEMCR_TRCENA      (1u << 24)
+#define DWT_CTRL_CYCCNTENA (1u << 0)
+
+// CP10/CP11 full access, needed before any hardware float instruction runs
+static inline void fpu_enable(void)
+{
+	CPACR |= (0xFu << 20);
+	__asm volatile ("dsb\n\tisb" ::: "memory");
+}
+
+static inline void cycle_counter_init(void)
+{
+	DEMCR |= DEMCR_TRCENA;
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+
+static inline uint32_t cycle_counter_get(void)
+{
+	return DWT_CYCCNT;
+}
+
+#endif /* CYCLE_COUNTER_H_ */
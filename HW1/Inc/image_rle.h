@@ -0,0 +1,132 @@
+/*
+ * image_rle.h
+ *
+ *  Generated by image_to_header.py, do not edit.
+ *  64x64 pixels, RLE: 1681 bytes (41.0% of raw)
+ */
+
+#ifndef IMAGE_RLE_H_
+#define IMAGE_RLE_H_
+
+#include <stdint.h>
+#include "image_codec.h"
+
+static const uint8_t image_rle_data[1681]
+	__attribute__((aligned(4), section(".rodata.images"))) = {
+  131, 146, 177, 182, 141, 146, 173, 182, 142, 146, 174, 182, 140, 146, 177, 182,
+  139, 146, 128, 182, 0, 146, 176, 182, 137, 146, 177, 182, 140, 146, 175, 182,
+  139, 146, 177, 182, 139, 146, 177, 182, 140, 146, 148, 182, 0, 109, 128, 73,
+  1, 109, 146, 149, 182, 138, 146, 149, 182, 0, 36, 131, 0, 0, 73, 148,
+  182, 138, 146, 149, 182, 133, 0, 1, 36, 109, 146, 182, 138, 146, 148, 182,
+  0, 73, 134, 0, 0, 36, 146, 182, 136, 146, 150, 182, 0, 36, 132, 0,
+  3, 36, 0, 36, 146, 145, 182, 137, 146, 148, 182, 0, 146, 128, 0, 3,
+  36, 73, 0, 36, 128, 146, 0, 73, 128, 36, 0, 73, 142, 182, 140, 146,
+  147, 182, 0, 109, 128, 0, 6, 36, 109, 36, 109, 146, 73, 109, 130, 73,
+  1, 109, 146, 140, 182, 137, 146, 143, 182, 0, 146, 130, 109, 0, 73, 130,
+  0, 128, 109, 0, 146, 129, 182, 1, 36, 109, 128, 146, 1, 73, 146, 140,
+  182, 137, 146, 142, 182, 0, 73, 133, 0, 0, 36, 128, 73, 1, 36, 73,
+  128, 146, 6, 109, 73, 36, 73, 109, 36, 73, 128, 109, 138, 182, 138, 146,
+  141, 182, 0, 146, 134, 0, 5, 36, 182, 109, 36, 0, 73, 129, 109, 130,
+  36, 1, 109, 146, 128, 182, 0, 109, 137, 182, 137, 146, 140, 182, 0, 146,
+  136, 0, 128, 146, 0, 73, 128, 0, 2, 73, 182, 109, 129, 36, 1, 73,
+  36, 128, 109, 2, 73, 36, 146, 136, 182, 137, 146, 139, 182, 0, 109, 137,
+  0, 128, 73, 0, 36, 128, 0, 2, 109, 182, 109, 128, 36, 128, 73, 1,
+  36, 73, 140, 182, 137, 146, 138, 182, 0, 73, 138, 0, 128, 36, 129, 0,
+  0, 36, 128, 182, 130, 73, 128, 0, 0, 146, 139, 182, 137, 146, 137, 182,
+  0, 36, 139, 0, 128, 36, 128, 0, 128, 73, 3, 109, 146, 73, 146, 128,
+  182, 1, 0, 36, 140, 182, 138, 146, 135, 182, 0, 36, 143, 0, 0, 73,
+  128, 0, 0, 109, 128, 146, 4, 219, 255, 182, 36, 73, 141, 182, 137, 146,
+  134, 182, 0, 36, 143, 0, 0, 73, 129, 0, 1, 36, 182, 129, 219, 2,
+  109, 0, 109, 139, 182, 140, 146, 132, 182, 0, 109, 143, 0, 0, 73, 131,
+  0, 5, 109, 73, 146, 109, 0, 36, 139, 182, 141, 146, 132, 182, 0, 36,
+  142, 0, 1, 73, 36, 131, 0, 0, 36, 130, 0, 0, 73, 135, 182, 3,
+  146, 182, 146, 182, 141, 146, 132, 182, 0, 73, 141, 0, 128, 36, 132, 0,
+  0, 73, 128, 36, 129, 0, 135, 182, 129, 146, 0, 182, 141, 146, 132, 182,
+  1, 146, 36, 138, 0, 0, 36, 135, 0, 3, 109, 36, 146, 36, 128, 0,
+  0, 146, 131, 182, 132, 146, 0, 182, 139, 146, 135, 182, 1, 146, 36, 136,
+  0, 0, 36, 136, 0, 0, 36, 128, 0, 2, 36, 0, 146, 132, 182, 130,
+  146, 129, 182, 139, 146, 136, 182, 1, 146, 36, 135, 0, 129, 36, 134, 0,
+  1, 36, 73, 129, 0, 0, 146, 133, 182, 129, 146, 129, 182, 139, 146, 137,
+  182, 0, 109, 136, 0, 0, 36, 134, 0, 128, 36, 0, 182, 128, 36, 1,
+  0, 73, 134, 182, 128, 146, 129, 182, 139, 146, 137, 182, 0, 73, 145, 0,
+  128, 36, 4, 182, 109, 182, 73, 36, 133, 182, 129, 146, 129, 182, 139, 146,
+  137, 182, 0, 36, 142, 0, 10, 146, 73, 0, 36, 0, 219, 146, 182, 146,
+  0, 109, 133, 182, 128, 146, 129, 182, 129, 146, 130, 182, 132, 146, 136, 182,
+  0, 146, 142, 0, 0, 36, 128, 182, 128, 36, 2, 73, 219, 146, 128, 182,
+  128, 36, 128, 182, 3, 219, 182, 146, 182, 129, 146, 129, 182, 139, 146, 136,
+  182, 0, 73, 142, 0, 0, 109, 128, 182, 9, 0, 73, 109, 219, 146, 182,
+  146, 73, 0, 146, 130, 182, 130, 146, 129, 182, 144, 146, 130, 182, 0, 146,
+  143, 0, 6, 146, 182, 146, 36, 73, 109, 219, 128, 146, 3, 73, 109, 0,
+  73, 132, 182, 128, 146, 129, 182, 139, 146, 130, 109, 0, 146, 130, 182, 0,
+  73, 142, 0, 0, 73, 128, 182, 1, 109, 36, 128, 109, 0, 219, 128, 146,
+  3, 109, 146, 73, 0, 128, 146, 130, 182, 128, 146, 129, 182, 139, 146, 130,
+  109, 0, 146, 130, 182, 143, 0, 0, 146, 128, 219, 6, 73, 36, 182, 109,
+  219, 146, 182, 129, 146, 1, 0, 73, 136, 182, 139, 146, 128, 109, 130, 146,
+  2, 109, 73, 36, 143, 0, 129, 182, 5, 36, 73, 182, 109, 219, 146, 129,
+  182, 2, 146, 36, 0, 133, 146, 0, 109, 128, 146, 134, 182, 0, 146, 130,
+  109, 134, 73, 143, 0, 0, 36, 128, 146, 5, 109, 0, 73, 109, 73, 219,
+  131, 146, 1, 109, 0, 129, 73, 2, 36, 109, 182, 128, 73, 1, 109, 146,
+  133, 182, 1, 146, 109, 136, 73, 1, 109, 73, 143, 0, 131, 36, 3, 73,
+  36, 73, 182, 128, 109, 129, 73, 0, 109, 128, 36, 129, 73, 1, 109, 36,
+  128, 0, 128, 36, 0, 73, 130, 182, 128, 73, 1, 109, 73, 128, 36, 128,
+  73, 133, 109, 0, 73, 143, 0, 129, 146, 1, 73, 36, 128, 73, 3, 109,
+  73, 109, 146, 128, 109, 129, 73, 0, 0, 129, 73, 0, 109, 131, 36, 9,
+  0, 36, 109, 146, 73, 36, 73, 109, 36, 0, 129, 36, 0, 109, 128, 146,
+  128, 109, 128, 146, 0, 36, 142, 0, 0, 73, 129, 219, 2, 36, 73, 109,
+  128, 73, 4, 146, 73, 36, 146, 73, 129, 109, 1, 0, 36, 129, 109, 128,
+  73, 0, 109, 129, 73, 130, 109, 0, 73, 128, 109, 131, 36, 0, 109, 129,
+  146, 2, 109, 146, 109, 143, 0, 0, 73, 129, 146, 1, 0, 73, 128, 109,
+  1, 73, 182, 129, 109, 130, 146, 2, 73, 0, 109, 152, 146, 0, 73, 143,
+  0, 0, 109, 128, 146, 6, 109, 0, 73, 109, 146, 109, 182, 134, 146, 1,
+  0, 73, 145, 146, 0, 109, 132, 146, 0, 36, 142, 0, 0, 36, 129, 146,
+  6, 73, 36, 73, 109, 146, 73, 182, 128, 146, 129, 109, 0, 146, 128, 109,
+  1, 36, 0, 146, 109, 130, 146, 128, 109, 143, 0, 0, 73, 129, 146, 2,
+  36, 73, 36, 128, 146, 1, 109, 182, 132, 109, 0, 146, 128, 109, 1, 0,
+  73, 145, 109, 131, 146, 1, 109, 73, 142, 0, 0, 109, 129, 146, 0, 0,
+  128, 73, 3, 146, 109, 73, 182, 133, 109, 1, 146, 109, 128, 36, 145, 109,
+  133, 146, 1, 109, 36, 140, 0, 130, 146, 2, 0, 73, 109, 128, 146, 1,
+  109, 182, 133, 146, 4, 109, 146, 109, 0, 109, 130, 146, 140, 109, 135, 146,
+  139, 0, 0, 36, 129, 146, 3, 73, 0, 73, 146, 128, 109, 136, 146, 3,
+  109, 146, 36, 73, 130, 146, 140, 109, 134, 146, 2, 109, 0, 36, 137, 0,
+  0, 73, 129, 146, 1, 73, 109, 141, 146, 0, 109, 128, 146, 0, 109, 130,
+  146, 139, 109, 134, 146, 2, 109, 0, 36, 137, 0, 0, 109, 129, 146, 0,
+  36, 128, 73, 129, 146, 0, 109, 129, 146, 128, 109, 131, 146, 128, 109, 1,
+  0, 73, 140, 109, 129, 146, 1, 109, 146, 129, 109, 3, 146, 109, 146, 109,
+  128, 0, 0, 36, 135, 0, 0, 36, 130, 109, 0, 0, 128, 73, 133, 109,
+  132, 146, 129, 109, 1, 73, 0, 141, 109, 128, 73, 130, 109, 130, 146, 0,
+  109, 128, 0, 128, 36, 134, 0, 0, 73, 129, 109, 1, 73, 0, 128, 73,
+  133, 109, 135, 146, 2, 109, 0, 73, 129, 146, 144, 109, 3, 146, 109, 146,
+  73, 128, 0, 130, 36, 132, 0, 0, 73, 129, 109, 2, 73, 0, 73, 133,
+  109, 1, 146, 109, 135, 146, 1, 36, 0, 143, 109, 133, 146, 0, 73, 128,
+  0, 129, 36, 0, 73, 130, 0, 128, 36, 130, 109, 2, 73, 36, 73, 131,
+  109, 128, 146, 128, 109, 133, 146, 129, 109, 1, 36, 146, 149, 109, 0, 73,
+  128, 0, 129, 36, 0, 109, 130, 0, 128, 36, 128, 146, 128, 109, 2, 73,
+  219, 146, 128, 109, 0, 146, 128, 109, 128, 146, 133, 109, 2, 146, 109, 146,
+  129, 109, 0, 182, 146, 109, 0, 146, 128, 109, 2, 73, 36, 0, 129, 36,
+  0, 146, 128, 36, 128, 0, 1, 36, 73, 128, 146, 5, 109, 146, 73, 255,
+  182, 146, 129, 109, 0, 146, 135, 109, 1, 146, 109, 128, 146, 128, 109, 0,
+  146, 141, 109, 129, 146, 128, 109, 128, 146, 4, 109, 73, 0, 36, 0, 128,
+  36, 0, 146, 128, 36, 129, 0, 0, 73, 130, 109, 2, 73, 219, 146, 128,
+  109, 0, 146, 129, 109, 0, 146, 130, 109, 0, 146, 134, 109, 1, 73, 182,
+  142, 109, 0, 146, 131, 109, 6, 73, 0, 36, 0, 36, 73, 146, 128, 36,
+  129, 0, 0, 73, 129, 109, 2, 73, 109, 219, 130, 109, 128, 146, 130, 109,
+  128, 146, 128, 109, 128, 146, 132, 109, 0, 146, 142, 109, 0, 146, 131, 109,
+  1, 36, 0, 129, 36, 3, 109, 146, 36, 73, 130, 36, 129, 109, 2, 73,
+  146, 182, 131, 109, 0, 146, 130, 109, 128, 146, 130, 109, 128, 146, 131, 109,
+  0, 146, 128, 109, 0, 146, 143, 109, 0, 146, 128, 36, 0, 0, 128, 36,
+  128, 109, 130, 36, 1, 0, 73, 128, 109, 2, 146, 36, 219, 128, 146, 140,
+  109, 128, 146, 131, 109, 1, 73, 182, 129, 109, 128, 146, 135, 109, 3, 146,
+  109, 146, 109, 129, 146, 128, 36, 0, 0, 128, 36, 128, 109, 5, 36, 0,
+  36, 73, 36, 73, 129, 109, 1, 36, 219, 151, 109, 2, 146, 109, 73, 136,
+  109
+};
+
+static const compressed_image_t image_rle = {
+	.codec = IMAGE_CODEC_RLE,
+	.width = 64,
+	.height = 64,
+	.size = sizeof(image_rle_data),
+	.data = image_rle_data,
+};
+
+#endif /* IMAGE_RLE_H_ */
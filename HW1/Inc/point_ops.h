@@ -0,0 +1,146 @@
+/*
+ * point_ops.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef POINT_OPS_H_
+#define POINT_OPS_H_
+
+#include <stdint.h>
+#include "image_view.h"
+
+// Threshold used by Q2 and as the breakpoint of the Q4 piecewise transform
+#define POINT_OPS_T 116
+
+/*
+ * 256-entry lookup tables, one per intensity transformation.
+ * They are constant initialisers, so they are built by the compiler and
+ * live in flash; applying a transform costs one table load per pixel.
+ */
+extern const uint8_t lut_neg[256];          // Q1  s = 255 - r
+extern const uint8_t lut_thresholded[256];  // Q2  s = 255 if r > T else 0
+extern const uint8_t lut_gc3[256];          // Q3  s = 255 * (r/255)^(1/3)
+extern const uint8_t lut_gc1_3[256];        // Q3  s = 255 * (r/255)^3
+extern const uint8_t lut_pwlt[256];         // Q4  0..T -> 0..128, T..255 -> 128..255
+
+// src and dst may be the same buffer for in-place operation
+void point_op_apply(const uint8_t *lut, const uint8_t *src, uint8_t *dst, uint32_t size);
+
+/*
+ * The same operations on 8-bit image views: whole frames, ROIs or
+ * sub-windows of a larger buffer, row by row without copying.
+ * src and dst must have the same size and may be the same view.
+ */
+void point_op_apply_view(const uint8_t *lut, const image_view_t *src, const image_view_t *dst);
+void point_op_negative_view(const image_view_t *src, const image_view_t *dst);
+void point_op_threshold_view(const image_view_t *src, const image_view_t *dst, uint8_t T);
+
+/*
+ * Row-chunked streaming. The frame is pulled from `source` in chunks of at
+ * most `buf_size` pixels that never cross a row boundary, transformed in
+ * place in `buf` and handed to `sink`. `buf` is the only working memory, so
+ * the frame size is not limited by RAM.
+ */
+typedef void (*point_source_t)(void *ctx, uint32_t y, uint32_t x, uint8_t *px, uint32_t len);
+typedef void (*point_sink_t)(void *ctx, uint32_t y, uint32_t x, const uint8_t *px, uint32_t len);
+
+typedef struct {
+	point_source_t source;
+	point_sink_t sink;
+	void *ctx;
+	uint8_t *buf;
+	uint32_t buf_size;
+} point_stream_t;
+
+void point_op_stream(const uint8_t *lut, const point_stream_t *stream, uint32_t width, uint32_t height);
+
+/*
+ * Composition of point operations. A chain of N transforms collapses into a
+ * single table, so the image is read and written once instead of N times.
+ *   point_op_compose: dst[r] = second[first[r]]  (dst may alias first)
+ *   point_op_chain:   dst = luts[count-1] o ... o luts[1] o luts[0]
+ */
+void point_op_identity(uint8_t *dst);
+void point_op_compose(uint8_t *dst, const uint8_t *first, const uint8_t *second);
+void point_op_chain(uint8_t *dst, const uint8_t *const *luts, uint32_t count);
+
+/*
+ * Fused multi-output kernel: every source pixel is loaded once and all the
+ * outputs selected in `mask` are written in the same iteration. Pointers of
+ * unselected outputs are ignored and may be NULL. One of the outputs may be
+ * `src` itself, so it also works in place and on row chunks.
+ */
+#define POINT_OUT_NEG          (1u << 0)
+#define POINT_OUT_THRESHOLDED  (1u << 1)
+#define POINT_OUT_GC3          (1u << 2)
+#define POINT_OUT_GC1_3        (1u << 3)
+#define POINT_OUT_PWLT         (1u << 4)
+#define POINT_OUT_ALL          0x1Fu
+
+typedef struct {
+	uint8_t *neg;
+	uint8_t *thresholded;
+	uint8_t *gc3;
+	uint8_t *gc1_3;
+	uint8_t *pwlt;
+} point_outputs_t;
+
+void point_op_fused(const uint8_t *src, uint32_t size, uint32_t mask, const point_outputs_t *out);
+
+/*
+ * Word-parallel negative and threshold (pixel > T -> 0xFF, else 0x00).
+ * point_op_negative/point_op_threshold select the widest implementation the
+ * target supports at compile time: Cortex-M4 DSP (USUB8/SEL), SSE2 on a
+ * host build, portable SWAR otherwise. The variants are exported for
+ * benchmarking and cross-checking.
+ */
+void point_op_negative(const uint8_t *src, uint8_t *dst, uint32_t size);
+void point_op_threshold(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T);
+
+void point_op_negative_scalar(const uint8_t *src, uint8_t *dst, uint32_t size);
+void point_op_negative_swar(const uint8_t *src, uint8_t *dst, uint32_t size);
+void point_op_threshold_scalar(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T);
+void point_op_threshold_swar(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T);
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+void point_op_threshold_dsp(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T);
+#endif
+#if defined(__SSE2__)
+void point_op_negative_sse2(const uint8_t *src, uint8_t *dst, uint32_t size);
+void point_op_threshold_sse2(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T);
+#endif
+
+/*
+ * General piecewise-linear contrast stretch in fixed point (Q16 slopes).
+ * Breakpoints are (in, out) pairs with strictly increasing `in`; inputs below
+ * the first or above the last breakpoint are clamped to its output.
+ * pwl_init returns 0, or -1 for an invalid breakpoint list. Use pwl_to_lut
+ * and point_op_apply for whole images, pwl_apply evaluates per pixel.
+ */
+#define PWL_MAX_POINTS 16
+
+typedef struct {
+	uint8_t in;
+	uint8_t out;
+} pwl_point_t;
+
+typedef struct {
+	uint8_t x0;
+	uint8_t y0;
+	int32_t slope_q16;
+} pwl_segment_t;
+
+typedef struct {
+	pwl_segment_t seg[PWL_MAX_POINTS - 1];
+	uint32_t count;
+	uint8_t x_end;
+	uint8_t y_end;
+} pwl_t;
+
+int pwl_init(pwl_t *pwl, const pwl_point_t *points, uint32_t count);
+uint8_t pwl_eval(const pwl_t *pwl, uint8_t r);
+void pwl_apply(const pwl_t *pwl, const uint8_t *src, uint8_t *dst, uint32_t size);
+void pwl_to_lut(const pwl_t *pwl, uint8_t *lut);
+
+#endif /* POINT_OPS_H_ */
@@ -0,0 +1,35 @@
+/*
+ * stack_monitor.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef STACK_MONITOR_H_
+#define STACK_MONITOR_H_
+
+#include <stdint.h>
+
+/*
+ * Peak stack measurement by painting, the same approach as stackMonInit()
+ * and MON_STACK_MARK()/MON_STACK_EVALUATE() in the X-CUBE-AI test utilities
+ * of HW5: the free stack below the current stack pointer is filled with a
+ * known pattern, the code under test runs, and the first overwritten word
+ * gives the deepest point the stack reached.
+ *
+ *   stack_monitor_mark(40 * 1024);
+ *   function_under_test();
+ *   used = stack_monitor_evaluate();
+ *
+ * `msize` is how far below the caller's stack pointer to watch; it is
+ * clamped to the end of .bss/heap start (_end).
+ * stack_monitor_evaluate() returns the used bytes, or STACK_MONITOR_OVERFLOW
+ * if the whole watched region was used.
+ */
+#define STACK_MONITOR_PATTERN  0xDEDEDEDEu
+#define STACK_MONITOR_OVERFLOW 0xFFFFFFFFu
+
+void stack_monitor_mark(uint32_t msize);
+uint32_t stack_monitor_evaluate(void);
+
+#endif /* STACK_MONITOR_H_ */
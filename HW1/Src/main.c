@@ -17,18 +17,90 @@
  */
 
 #include <stdint.h>
+#include <stddef.h>
 #include <math.h>
 #include "image.h"
-
-#if !defined(__SOFT_FP__) && defined(__ARM_FP)
-  #warning "FPU is not initialized, but the project is compiling for an FPU. Please initialize the FPU before use."
-#endif
+#include "point_ops.h"
+#include "cycle_counter.h"
+#include "stack_monitor.h"
+#include "image_codec.h"
+#include "image_rle.h"
+#include "image_lz4.h"
 
 #define size 64*64
 
-int main(void)
+// Larger synthetic frame for the streaming test, tiled from the 64x64 image
+#define STREAM_WIDTH  512
+#define STREAM_HEIGHT 512
+#define STREAM_CHUNK  256
+
+// How far below main's stack pointer the stack monitor watches
+#define STACK_WATCH_SIZE (40 * 1024)
+
+/*
+ * Benchmark of the Q1-Q4 loops against the lookup tables in point_ops.c.
+ * Read the results with Live Expressions or the Memory window.
+ */
+enum { BENCH_NEG, BENCH_THRESHOLD, BENCH_GC3, BENCH_GC1_3, BENCH_PWLT, BENCH_COUNT };
+volatile uint32_t bench_loop_cycles[BENCH_COUNT];
+volatile uint32_t bench_lut_cycles[BENCH_COUNT];
+volatile float bench_loop_cycles_per_pixel[BENCH_COUNT];
+volatile float bench_lut_cycles_per_pixel[BENCH_COUNT];
+volatile uint32_t bench_lut_mismatches;
+
+// pwlt -> gc3 -> threshold -> negative, one pass per step vs one composed table
+volatile uint32_t bench_chain_steps_cycles;
+volatile uint32_t bench_chain_composed_cycles;
+volatile uint32_t bench_chain_mismatches;
+
+// All five outputs from one pass over the source vs the five loops of Q1-Q4
+volatile uint32_t bench_five_loops_cycles;
+volatile uint32_t bench_fused_cycles;
+volatile uint32_t bench_fused_mismatches;
+
+// Negative and threshold: byte loop vs 4 pixels per word (SWAR) vs DSP dispatch
+enum { IMPL_SCALAR, IMPL_SWAR, IMPL_DISPATCH, IMPL_COUNT };
+volatile uint32_t bench_neg_cycles[IMPL_COUNT];
+volatile uint32_t bench_threshold_cycles[IMPL_COUNT];
+volatile uint32_t bench_word_mismatches;
+
+// Fixed-point piecewise-linear engine vs the double-precision Q4 math
+volatile uint32_t bench_pwl_direct_cycles;
+volatile uint32_t bench_pwl_lut_cycles;
+volatile int32_t bench_pwl_max_error;
+
+// Peak stack: original code with five frames on the stack vs 512x512 streaming
+volatile uint32_t bench_stack_full_frame;
+volatile uint32_t bench_stack_streaming;
+volatile uint32_t bench_stream_cycles;
+volatile uint32_t bench_stream_mismatches;
+
+// Compressed copies of image[] decoded row by row straight into the stream
+enum { CODEC_RLE, CODEC_LZ4, CODEC_COUNT };
+volatile uint32_t bench_codec_bytes[CODEC_COUNT];   // flash bytes read per frame (raw: 4096)
+volatile uint32_t bench_codec_cycles[CODEC_COUNT];
+
+// Output of the last transform, view it with the Memory window
+uint8_t frame_out[size];
+
+static const uint8_t *const luts[BENCH_COUNT] = { lut_neg, lut_thresholded, lut_gc3, lut_gc1_3, lut_pwlt };
+
+static void count_mismatches(const uint8_t *lut, const uint8_t *src, const uint8_t *out,
+                             uint32_t n, volatile uint32_t *mismatches)
 {
-	const uint8_t *a = &image;
+	for(uint32_t i = 0; i < n; i++){
+		if(out[i] != lut[src[i]]) (*mismatches)++;
+	}
+}
+
+/*
+ * Original Q1-Q4 code, with its five full-frame arrays on the stack (20 KB).
+ * It is the reference for everything below: it times the loops and checks
+ * the lookup tables against them while the arrays are still alive.
+ */
+static void q1_q4_reference(const uint8_t *a)
+{
+	uint32_t t0;
 
 	// Q1 Negative of the image
 	/*
@@ -42,9 +114,11 @@ int main(void)
 	z = x ^ y;
 	*/
 	uint8_t neg[size];
+	t0 = cycle_counter_get();
 	for(int i = 0; i<size; i++){
 		neg[i] = a[i] ^ 0b11111111;
 	}
+	bench_loop_cycles[BENCH_NEG] = cycle_counter_get() - t0;
 
 	// Q2 Thersholding by 116 (average value)
 	/*
@@ -54,9 +128,11 @@ int main(void)
 	 */
 	uint8_t thresholded[size];
 	int T = 116;
+	t0 = cycle_counter_get();
 	for(int i = 0; i<size; i++){
 			thresholded[i] = a[i]>T?0xFF:0x00;
 		}
+	bench_loop_cycles[BENCH_THRESHOLD] = cycle_counter_get() - t0;
 
 	//gc = 0xFF * (img/0xFF)^(1/gamma)
 	// Q3.1 Gamma correction when gamma = 3
@@ -64,19 +140,23 @@ int main(void)
 	 * gc3 = 0xFF * (img/0xFF)^(1/3)
 	 */
 	uint8_t gc3[size];
+	t0 = cycle_counter_get();
 	for(int i = 0; i<size; i++){
 		gc3[i] = 0xFF * pow((a[i] / 255.0), 1.0 / 3.0);
 
 	}
+	bench_loop_cycles[BENCH_GC3] = cycle_counter_get() - t0;
 
 	// Q3.1 Gamma correction when gamma = 1/3
 	/*
 	 * gc1_3 = 0xFF * (img/0xFF)^3
 	*/
 	uint8_t gc1_3[size];
+	t0 = cycle_counter_get();
 	for(int i = 0; i<size; i++){
 		gc1_3[i] = 0xFF * pow((a[i] / 255.0), 3.0);
 	}
+	bench_loop_cycles[BENCH_GC1_3] = cycle_counter_get() - t0;
 
 	// Q4 Piecewise linear transformations
 	/*
@@ -86,6 +166,7 @@ int main(void)
 	uint8_t pwlt[size];
 	const double f1 = 128.0 / T;
 	const double f2 = (255.0 - 128.0) / (255.0 - T);
+	t0 = cycle_counter_get();
 	for(int i = 0; i<size; i++){
 		if(a[i] <= T){
 			pwlt[i] = f1 * (double)a[i];
@@ -94,6 +175,233 @@ int main(void)
 			pwlt[i] = 128.0 + f2 * ((double)a[i] - T);
 		}
 	}
+	bench_loop_cycles[BENCH_PWLT] = cycle_counter_get() - t0;
+
+	// The tables must reproduce the loops exactly
+	const uint8_t *refs[BENCH_COUNT] = { neg, thresholded, gc3, gc1_3, pwlt };
+	bench_lut_mismatches = 0;
+	for(int k = 0; k < BENCH_COUNT; k++){
+		for(int i = 0; i<size; i++){
+			if(luts[k][a[i]] != refs[k][i]) bench_lut_mismatches++;
+		}
+	}
+}
+
+// Streaming source: a STREAM_WIDTH x STREAM_HEIGHT frame tiled from image[]
+static void tiled_source(void *ctx, uint32_t y, uint32_t x, uint8_t *px, uint32_t len)
+{
+	(void)ctx;
+	const uint8_t *row = &image[(y % IMG64_HEIGHT) * IMG64_WIDTH];
+	for(uint32_t i = 0; i < len; i++){
+		px[i] = row[(x + i) % IMG64_WIDTH];
+	}
+}
+
+// Streaming sink: checks every chunk against lut_pwlt instead of storing it
+static void checking_sink(void *ctx, uint32_t y, uint32_t x, const uint8_t *px, uint32_t len)
+{
+	(void)ctx;
+	const uint8_t *row = &image[(y % IMG64_HEIGHT) * IMG64_WIDTH];
+	for(uint32_t i = 0; i < len; i++){
+		if(px[i] != lut_pwlt[row[(x + i) % IMG64_WIDTH]]) bench_stream_mismatches++;
+	}
+}
+
+static void stream_large_frame(void)
+{
+	uint8_t chunk[STREAM_CHUNK];
+	const point_stream_t stream = {
+		.source = tiled_source,
+		.sink = checking_sink,
+		.ctx = NULL,
+		.buf = chunk,
+		.buf_size = sizeof(chunk),
+	};
+
+	bench_stream_mismatches = 0;
+	uint32_t t0 = cycle_counter_get();
+	point_op_stream(lut_pwlt, &stream, STREAM_WIDTH, STREAM_HEIGHT);
+	bench_stream_cycles = cycle_counter_get() - t0;
+}
+
+static void stream_compressed(int k, const compressed_image_t *img)
+{
+	image_decoder_t dec;
+	uint8_t row[IMG64_WIDTH];
+	const point_stream_t stream = {
+		.source = image_decoder_source,
+		.sink = checking_sink,
+		.ctx = &dec,
+		.buf = row,
+		.buf_size = sizeof(row),
+	};
+
+	image_decoder_init(&dec, img);
+	uint32_t t0 = cycle_counter_get();
+	point_op_stream(lut_pwlt, &stream, img->width, img->height);
+	bench_codec_cycles[k] = cycle_counter_get() - t0;
+	bench_codec_bytes[k] = dec.in_pos;
+}
+
+int main(void)
+{
+	const uint8_t *a = &image;
+	uint32_t t0;
+
+	fpu_enable();
+	cycle_counter_init();
+
+	stack_monitor_mark(STACK_WATCH_SIZE);
+	q1_q4_reference(a);
+	bench_stack_full_frame = stack_monitor_evaluate();
+
+	// Same transforms through the lookup tables, one frame buffer reused
+	for(int k = 0; k < BENCH_COUNT; k++){
+		t0 = cycle_counter_get();
+		point_op_apply(luts[k], a, frame_out, size);
+		bench_lut_cycles[k] = cycle_counter_get() - t0;
+
+		bench_loop_cycles_per_pixel[k] = (float)bench_loop_cycles[k] / (size);
+		bench_lut_cycles_per_pixel[k] = (float)bench_lut_cycles[k] / (size);
+	}
+
+	// Chained point operations collapsed into a single table, row by row
+	const uint8_t *chain[] = { lut_pwlt, lut_gc3, lut_thresholded, lut_neg };
+	const uint32_t chain_len = sizeof(chain) / sizeof(chain[0]);
+	uint8_t chain_lut[256];
+	uint8_t row_steps[IMG64_WIDTH];
+	uint8_t row_composed[IMG64_WIDTH];
+
+	t0 = cycle_counter_get();
+	point_op_chain(chain_lut, chain, chain_len);
+	bench_chain_composed_cycles = cycle_counter_get() - t0;
+	bench_chain_steps_cycles = 0;
+	bench_chain_mismatches = 0;
+
+	for(int y = 0; y < IMG64_HEIGHT; y++){
+		const uint8_t *src_row = &a[y * IMG64_WIDTH];
+
+		t0 = cycle_counter_get();
+		point_op_apply(chain[0], src_row, row_steps, IMG64_WIDTH);
+		for(uint32_t k = 1; k < chain_len; k++){
+			point_op_apply(chain[k], row_steps, row_steps, IMG64_WIDTH);
+		}
+		bench_chain_steps_cycles += cycle_counter_get() - t0;
+
+		t0 = cycle_counter_get();
+		point_op_apply(chain_lut, src_row, row_composed, IMG64_WIDTH);
+		bench_chain_composed_cycles += cycle_counter_get() - t0;
+
+		for(int x = 0; x < IMG64_WIDTH; x++){
+			if(row_steps[x] != row_composed[x]) bench_chain_mismatches++;
+		}
+	}
+
+	// Q1-Q4 outputs in a single pass over the source image, row by row
+	uint8_t fused[BENCH_COUNT][IMG64_WIDTH];
+	const point_outputs_t fused_out = {
+		.neg = fused[BENCH_NEG],
+		.thresholded = fused[BENCH_THRESHOLD],
+		.gc3 = fused[BENCH_GC3],
+		.gc1_3 = fused[BENCH_GC1_3],
+		.pwlt = fused[BENCH_PWLT],
+	};
+
+	bench_fused_cycles = 0;
+	bench_fused_mismatches = 0;
+	for(int y = 0; y < IMG64_HEIGHT; y++){
+		const uint8_t *src_row = &a[y * IMG64_WIDTH];
+
+		t0 = cycle_counter_get();
+		point_op_fused(src_row, IMG64_WIDTH, POINT_OUT_ALL, &fused_out);
+		bench_fused_cycles += cycle_counter_get() - t0;
+
+		for(int k = 0; k < BENCH_COUNT; k++){
+			count_mismatches(luts[k], src_row, fused[k], IMG64_WIDTH, &bench_fused_mismatches);
+		}
+	}
+
+	bench_five_loops_cycles = 0;
+	for(int k = 0; k < BENCH_COUNT; k++){
+		bench_five_loops_cycles += bench_loop_cycles[k];
+	}
+
+	// Word-parallel negative and threshold
+	bench_word_mismatches = 0;
+	for(int impl = 0; impl < IMPL_COUNT; impl++){
+		t0 = cycle_counter_get();
+		if(impl == IMPL_SCALAR) point_op_negative_scalar(a, frame_out, size);
+		else if(impl == IMPL_SWAR) point_op_negative_swar(a, frame_out, size);
+		else point_op_negative(a, frame_out, size);
+		bench_neg_cycles[impl] = cycle_counter_get() - t0;
+		count_mismatches(lut_neg, a, frame_out, size, &bench_word_mismatches);
+
+		t0 = cycle_counter_get();
+		if(impl == IMPL_SCALAR) point_op_threshold_scalar(a, frame_out, size, POINT_OPS_T);
+		else if(impl == IMPL_SWAR) point_op_threshold_swar(a, frame_out, size, POINT_OPS_T);
+		else point_op_threshold(a, frame_out, size, POINT_OPS_T);
+		bench_threshold_cycles[impl] = cycle_counter_get() - t0;
+		count_mismatches(lut_thresholded, a, frame_out, size, &bench_word_mismatches);
+	}
+
+	// Q4 through the fixed-point piecewise-linear engine
+	const pwl_point_t q4_points[] = { {0, 0}, {POINT_OPS_T, 128}, {255, 255} };
+	pwl_t pwl;
+	uint8_t pwl_lut[256];
+	pwl_init(&pwl, q4_points, sizeof(q4_points) / sizeof(q4_points[0]));
+
+	bench_pwl_max_error = 0;
+	for(int pass = 0; pass < 2; pass++){
+		t0 = cycle_counter_get();
+		if(pass == 0){
+			pwl_apply(&pwl, a, frame_out, size);
+			bench_pwl_direct_cycles = cycle_counter_get() - t0;
+		}
+		else{
+			pwl_to_lut(&pwl, pwl_lut);
+			point_op_apply(pwl_lut, a, frame_out, size);
+			bench_pwl_lut_cycles = cycle_counter_get() - t0;
+		}
+
+		// lut_pwlt is bit-exact with the double-precision Q4 loop
+		for(int i = 0; i<size; i++){
+			int32_t e = (int32_t)frame_out[i] - lut_pwlt[a[i]];
+			if(e < 0) e = -e;
+			if(e > bench_pwl_max_error) bench_pwl_max_error = e;
+		}
+	}
+
+	// An arbitrary 4-segment stretch against its double-precision evaluation
+	const pwl_point_t stretch[] = { {0, 0}, {40, 10}, {100, 200}, {180, 230}, {255, 255} };
+	const int n_stretch = sizeof(stretch) / sizeof(stretch[0]);
+	pwl_init(&pwl, stretch, n_stretch);
+	pwl_to_lut(&pwl, pwl_lut);
+	for(int r = 0; r < 256; r++){
+		int k = 0;
+		while(k + 2 < n_stretch && r >= stretch[k + 1].in) k++;
+		const double f = (double)(stretch[k + 1].out - stretch[k].out) / (stretch[k + 1].in - stretch[k].in);
+		uint8_t ref = stretch[k].out + f * ((double)r - stretch[k].in);
+		int32_t e = (int32_t)pwl_lut[r] - ref;
+		if(e < 0) e = -e;
+		if(e > bench_pwl_max_error) bench_pwl_max_error = e;
+	}
+
+	// 512x512 frame through a 256-byte chunk buffer
+	stack_monitor_mark(STACK_WATCH_SIZE);
+	stream_large_frame();
+	bench_stack_streaming = stack_monitor_evaluate();
+
+	// Same checks fed from the RLE and LZ4 headers, adds to bench_stream_mismatches
+	stream_compressed(CODEC_RLE, &image_rle);
+	stream_compressed(CODEC_LZ4, &image_lz4);
+
+	// Leave Q4 in frame_out for the Memory window, with the centre 32x32
+	// region thresholded in place through an ROI view of the same buffer
+	const image_view_t src_view = image_view_make(a, IMG64_WIDTH, IMG64_HEIGHT, PIXEL_U8);
+	const image_view_t out_view = image_view_make(frame_out, IMG64_WIDTH, IMG64_HEIGHT, PIXEL_U8);
+	const image_view_t centre = image_view_roi(&out_view, 16, 16, 32, 32);
+	point_op_apply_view(lut_pwlt, &src_view, &out_view);
+	point_op_threshold_view(&centre, &centre, 128);
 
     /* Loop forever */
 	for(;;);
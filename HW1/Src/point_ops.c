@@ -0,0 +1,170 @@
+/*
+ * point_ops.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "point_ops.h"
+
+// Expand F(0), F(1), ... F(255) as a constant initialiser list
+#define LUT_16(F, i) \
+	F((i) +  0), F((i) +  1), F((i) +  2), F((i) +  3), \
+	F((i) +  4), F((i) +  5), F((i) +  6), F((i) +  7), \
+	F((i) +  8), F((i) +  9), F((i) + 10), F((i) + 11), \
+	F((i) + 12), F((i) + 13), F((i) + 14), F((i) + 15)
+#define LUT_256(F) \
+	LUT_16(F,   0), LUT_16(F,  16), LUT_16(F,  32), LUT_16(F,  48), \
+	LUT_16(F,  64), LUT_16(F,  80), LUT_16(F,  96), LUT_16(F, 112), \
+	LUT_16(F, 128), LUT_16(F, 144), LUT_16(F, 160), LUT_16(F, 176), \
+	LUT_16(F, 192), LUT_16(F, 208), LUT_16(F, 224), LUT_16(F, 240)
+
+/*
+ * Integer forms of the double expressions in main.c. The float results were
+ * truncated by the uint8_t conversion, so integer division gives the same
+ * value for every input:
+ *   0xFF * pow(r/255.0, 3.0)         == r^3 / 255^2
+ *   (128.0 / T) * r                  == 128 * r / T
+ *   128.0 + (127.0 / (255 - T)) * (r - T) == 128 + 127 * (r - T) / (255 - T)
+ */
+#define NEG(r)         ((uint8_t)(0xFF - (r)))
+#define THRESHOLD(r)   ((uint8_t)((r) > POINT_OPS_T ? 0xFF : 0x00))
+#define GC1_3(r)       ((uint8_t)(((r) * (r) * (r)) / (255 * 255)))
+#define PWLT(r)        ((uint8_t)((r) <= POINT_OPS_T ? \
+                           (128 * (r)) / POINT_OPS_T : \
+                           128 + (127 * ((r) - POINT_OPS_T)) / (255 - POINT_OPS_T)))
+
+const uint8_t lut_neg[256]         = { LUT_256(NEG) };
+const uint8_t lut_thresholded[256] = { LUT_256(THRESHOLD) };
+const uint8_t lut_gc1_3[256]       = { LUT_256(GC1_3) };
+const uint8_t lut_pwlt[256]        = { LUT_256(PWLT) };
+
+/*
+ * 0xFF * pow(r/255.0, 1.0/3.0) is floor(cbrt(255^2 * r)), the integer cube
+ * root, which the preprocessor cannot express compactly, so it is written out.
+ */
+const uint8_t lut_gc3[256] = {
+	  0,  40,  50,  57,  63,  68,  73,  76,  80,  83,  86,  89,  92,  94,  96,  99,
+	101, 103, 105, 107, 109, 110, 112, 114, 115, 117, 119, 120, 122, 123, 124, 126,
+	127, 128, 130, 131, 132, 133, 135, 136, 137, 138, 139, 140, 141, 143, 144, 145,
+	146, 147, 148, 149, 150, 151, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160,
+	160, 161, 162, 163, 164, 164, 165, 166, 167, 168, 168, 169, 170, 171, 171, 172,
+	173, 173, 174, 175, 176, 176, 177, 178, 178, 179, 180, 180, 181, 182, 182, 183,
+	184, 184, 185, 186, 186, 187, 187, 188, 189, 189, 190, 190, 191, 192, 192, 193,
+	193, 194, 194, 195, 196, 196, 197, 197, 198, 198, 199, 199, 200, 201, 201, 202,
+	202, 203, 203, 204, 204, 205, 205, 206, 206, 207, 207, 208, 208, 209, 209, 210,
+	210, 211, 211, 212, 212, 213, 213, 214, 214, 215, 215, 216, 216, 216, 217, 217,
+	218, 218, 219, 219, 220, 220, 221, 221, 221, 222, 222, 223, 223, 224, 224, 224,
+	225, 225, 226, 226, 227, 227, 227, 228, 228, 229, 229, 229, 230, 230, 231, 231,
+	231, 232, 232, 233, 233, 233, 234, 234, 235, 235, 235, 236, 236, 237, 237, 237,
+	238, 238, 239, 239, 239, 240, 240, 240, 241, 241, 242, 242, 242, 243, 243, 243,
+	244, 244, 244, 245, 245, 246, 246, 246, 247, 247, 247, 248, 248, 248, 249, 249,
+	249, 250, 250, 250, 251, 251, 251, 252, 252, 252, 253, 253, 253, 254, 254, 255
+};
+
+void point_op_apply(const uint8_t *lut, const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+	uint32_t i = 0;
+
+	// 4 pixels per iteration to hide the load-use latency of the table reads
+	for(; i + 4 <= size; i += 4){
+		uint8_t p0 = src[i];
+		uint8_t p1 = src[i + 1];
+		uint8_t p2 = src[i + 2];
+		uint8_t p3 = src[i + 3];
+		dst[i]     = lut[p0];
+		dst[i + 1] = lut[p1];
+		dst[i + 2] = lut[p2];
+		dst[i + 3] = lut[p3];
+	}
+	for(; i < size; i++){
+		dst[i] = lut[src[i]];
+	}
+}
+
+void point_op_apply_view(const uint8_t *lut, const image_view_t *src, const image_view_t *dst)
+{
+	for(uint32_t y = 0; y < src->height; y++){
+		point_op_apply(lut, IMAGE_VIEW_ROW_U8(src, y), IMAGE_VIEW_ROW_U8(dst, y), src->width);
+	}
+}
+
+void point_op_stream(const uint8_t *lut, const point_stream_t *stream, uint32_t width, uint32_t height)
+{
+	for(uint32_t y = 0; y < height; y++){
+		for(uint32_t x = 0; x < width; x += stream->buf_size){
+			uint32_t len = width - x;
+			if(len > stream->buf_size) len = stream->buf_size;
+
+			stream->source(stream->ctx, y, x, stream->buf, len);
+			point_op_apply(lut, stream->buf, stream->buf, len);
+			stream->sink(stream->ctx, y, x, stream->buf, len);
+		}
+	}
+}
+
+void point_op_identity(uint8_t *dst)
+{
+	for(int r = 0; r < 256; r++){
+		dst[r] = (uint8_t)r;
+	}
+}
+
+void point_op_compose(uint8_t *dst, const uint8_t *first, const uint8_t *second)
+{
+	for(int r = 0; r < 256; r++){
+		dst[r] = second[first[r]];
+	}
+}
+
+void point_op_chain(uint8_t *dst, const uint8_t *const *luts, uint32_t count)
+{
+	point_op_identity(dst);
+	for(uint32_t k = 0; k < count; k++){
+		point_op_compose(dst, dst, luts[k]);
+	}
+}
+
+void point_op_fused(const uint8_t *src, uint32_t size, uint32_t mask, const point_outputs_t *out)
+{
+	const uint8_t *luts[5];
+	uint8_t *dsts[5];
+	uint32_t n = 0;
+
+	if(mask & POINT_OUT_NEG)         { luts[n] = lut_neg;         dsts[n++] = out->neg; }
+	if(mask & POINT_OUT_THRESHOLDED) { luts[n] = lut_thresholded; dsts[n++] = out->thresholded; }
+	if(mask & POINT_OUT_GC3)         { luts[n] = lut_gc3;         dsts[n++] = out->gc3; }
+	if(mask & POINT_OUT_GC1_3)       { luts[n] = lut_gc1_3;       dsts[n++] = out->gc1_3; }
+	if(mask & POINT_OUT_PWLT)        { luts[n] = lut_pwlt;        dsts[n++] = out->pwlt; }
+
+	uint32_t i = 0;
+
+	/*
+	 * One word load brings in 4 source pixels; each selected output gets its
+	 * 4 results packed and written with a single word store.
+	 */
+	for(; i + 4 <= size; i += 4){
+		uint32_t w;
+		memcpy(&w, &src[i], 4);
+		uint8_t p0 = (uint8_t)w;
+		uint8_t p1 = (uint8_t)(w >> 8);
+		uint8_t p2 = (uint8_t)(w >> 16);
+		uint8_t p3 = (uint8_t)(w >> 24);
+
+		for(uint32_t k = 0; k < n; k++){
+			const uint8_t *lut = luts[k];
+			uint32_t o = (uint32_t)lut[p0]
+			           | ((uint32_t)lut[p1] << 8)
+			           | ((uint32_t)lut[p2] << 16)
+			           | ((uint32_t)lut[p3] << 24);
+			memcpy(&dsts[k][i], &o, 4);
+		}
+	}
+	for(; i < size; i++){
+		uint8_t p = src[i];
+		for(uint32_t k = 0; k < n; k++){
+			dsts[k][i] = luts[k][p];
+		}
+	}
+}
@@ -0,0 +1,86 @@
+/*
+ * point_ops_pwl.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include "point_ops.h"
+
+/*
+ * Slopes are rounded up to Q16. For a segment of width dx <= 255 the
+ * accumulated error stays below 255/65536, which is smaller than the 1/dx
+ * spacing of the exact fractional parts, so y0 + ((r - x0) * slope >> 16)
+ * is exactly floor() of the real line, i.e. what the uint8_t conversion of
+ * the double expression in main.c produces.
+ */
+int pwl_init(pwl_t *pwl, const pwl_point_t *points, uint32_t count)
+{
+	if(count < 2 || count > PWL_MAX_POINTS){
+		return -1;
+	}
+	for(uint32_t k = 1; k < count; k++){
+		if(points[k].in <= points[k - 1].in){
+			return -1;
+		}
+	}
+
+	pwl->count = count - 1;
+	for(uint32_t k = 0; k < pwl->count; k++){
+		int32_t dx = points[k + 1].in - points[k].in;
+		int32_t dy = points[k + 1].out - points[k].out;
+		int32_t num = dy * 65536;
+
+		pwl->seg[k].x0 = points[k].in;
+		pwl->seg[k].y0 = points[k].out;
+		// ceil(num / dx); C division truncates, which is already ceil for num < 0
+		pwl->seg[k].slope_q16 = (num >= 0) ? (num + dx - 1) / dx : num / dx;
+	}
+	pwl->x_end = points[count - 1].in;
+	pwl->y_end = points[count - 1].out;
+	return 0;
+}
+
+uint8_t pwl_eval(const pwl_t *pwl, uint8_t r)
+{
+	if(r < pwl->seg[0].x0){
+		return pwl->seg[0].y0;
+	}
+	if(r >= pwl->x_end){
+		return pwl->y_end;
+	}
+
+	uint32_t k = 0;
+	while(k + 1 < pwl->count && r >= pwl->seg[k + 1].x0){
+		k++;
+	}
+	const pwl_segment_t *s = &pwl->seg[k];
+	return (uint8_t)(s->y0 + (((int32_t)(r - s->x0) * s->slope_q16) >> 16));
+}
+
+void pwl_apply(const pwl_t *pwl, const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+	for(uint32_t i = 0; i < size; i++){
+		dst[i] = pwl_eval(pwl, src[i]);
+	}
+}
+
+void pwl_to_lut(const pwl_t *pwl, uint8_t *lut)
+{
+	int r = 0;
+
+	for(; r < pwl->seg[0].x0; r++){
+		lut[r] = pwl->seg[0].y0;
+	}
+	// Walk each segment once, one multiply and one shift per entry
+	for(uint32_t k = 0; k < pwl->count; k++){
+		const pwl_segment_t *s = &pwl->seg[k];
+		int end = (k + 1 < pwl->count) ? pwl->seg[k + 1].x0 : pwl->x_end;
+		for(; r < end; r++){
+			lut[r] = (uint8_t)(s->y0 + (((int32_t)(r - s->x0) * s->slope_q16) >> 16));
+		}
+	}
+	for(; r < 256; r++){
+		lut[r] = pwl->y_end;
+	}
+}
@@ -0,0 +1,166 @@
+/*
+ * point_ops_simd.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "point_ops.h"
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#define BYTES_0x80 0x80808080u
+#define BYTES_0x01 0x01010101u
+
+static inline uint32_t load_word(const uint8_t *p)
+{
+	uint32_t w;
+	memcpy(&w, p, 4);
+	return w;
+}
+
+static inline void store_word(uint8_t *p, uint32_t w)
+{
+	memcpy(p, &w, 4);
+}
+
+// Scalar reference, one byte per iteration (same as the Q1/Q2 loops)
+void point_op_negative_scalar(const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+	for(uint32_t i = 0; i < size; i++){
+		dst[i] = src[i] ^ 0xFF;
+	}
+}
+
+void point_op_threshold_scalar(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T)
+{
+	for(uint32_t i = 0; i < size; i++){
+		dst[i] = src[i] > T ? 0xFF : 0x00;
+	}
+}
+
+/*
+ * Portable SWAR: 4 pixels per 32-bit operation.
+ * Negative is a plain word NOT. For the threshold, every byte of
+ * z = (a | 0x80) - (t & 0x7F) keeps its own borrow, so bit 7 of each byte of
+ * z tells whether the low 7 bits of a are >= those of t; combining it with
+ * the top bits of a and t gives a >= t per byte, with t = T + 1.
+ */
+void point_op_negative_swar(const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+	uint32_t i = 0;
+	for(; i + 4 <= size; i += 4){
+		store_word(&dst[i], ~load_word(&src[i]));
+	}
+	point_op_negative_scalar(&src[i], &dst[i], size - i);
+}
+
+void point_op_threshold_swar(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T)
+{
+	if(T == 0xFF){
+		memset(dst, 0x00, size);
+		return;
+	}
+	const uint32_t t = (uint32_t)(T + 1) * BYTES_0x01;
+	uint32_t i = 0;
+	for(; i + 4 <= size; i += 4){
+		uint32_t a = load_word(&src[i]);
+		uint32_t z = (a | BYTES_0x80) - (t & ~BYTES_0x80);
+		uint32_t ge = ((a & ~t) | (~(a ^ t) & z)) & BYTES_0x80;
+		store_word(&dst[i], (ge >> 7) * 0xFFu);
+	}
+	point_op_threshold_scalar(&src[i], &dst[i], size - i, T);
+}
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+/*
+ * Cortex-M4 DSP extension: USUB8 sets one GE flag per byte where a >= t,
+ * and SEL then picks 0xFF or 0x00 per byte from those flags.
+ * The negative needs no DSP instruction, the SWAR word NOT is already a
+ * single MVN for 4 pixels.
+ */
+void point_op_threshold_dsp(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T)
+{
+	if(T == 0xFF){
+		memset(dst, 0x00, size);
+		return;
+	}
+	const uint32_t t = (uint32_t)(T + 1) * BYTES_0x01;
+	uint32_t i = 0;
+	for(; i + 4 <= size; i += 4){
+		(void)__usub8(load_word(&src[i]), t);
+		store_word(&dst[i], __sel(0xFFFFFFFFu, 0));
+	}
+	point_op_threshold_scalar(&src[i], &dst[i], size - i, T);
+}
+#endif
+
+#if defined(__SSE2__)
+// Host build: 16 pixels per operation, a > T <=> max(a, T + 1) == a
+void point_op_negative_sse2(const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+	const __m128i ones = _mm_set1_epi8((char)0xFF);
+	uint32_t i = 0;
+	for(; i + 16 <= size; i += 16){
+		__m128i a = _mm_loadu_si128((const __m128i *)&src[i]);
+		_mm_storeu_si128((__m128i *)&dst[i], _mm_xor_si128(a, ones));
+	}
+	point_op_negative_swar(&src[i], &dst[i], size - i);
+}
+
+void point_op_threshold_sse2(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T)
+{
+	if(T == 0xFF){
+		memset(dst, 0x00, size);
+		return;
+	}
+	const __m128i t = _mm_set1_epi8((char)(T + 1));
+	uint32_t i = 0;
+	for(; i + 16 <= size; i += 16){
+		__m128i a = _mm_loadu_si128((const __m128i *)&src[i]);
+		_mm_storeu_si128((__m128i *)&dst[i], _mm_cmpeq_epi8(_mm_max_epu8(a, t), a));
+	}
+	point_op_threshold_swar(&src[i], &dst[i], size - i, T);
+}
+#endif
+
+// Dispatch to the widest implementation the target supports
+void point_op_negative(const uint8_t *src, uint8_t *dst, uint32_t size)
+{
+#if defined(__SSE2__)
+	point_op_negative_sse2(src, dst, size);
+#else
+	point_op_negative_swar(src, dst, size);
+#endif
+}
+
+void point_op_threshold(const uint8_t *src, uint8_t *dst, uint32_t size, uint8_t T)
+{
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+	point_op_threshold_dsp(src, dst, size, T);
+#elif defined(__SSE2__)
+	point_op_threshold_sse2(src, dst, size, T);
+#else
+	point_op_threshold_swar(src, dst, size, T);
+#endif
+}
+
+void point_op_negative_view(const image_view_t *src, const image_view_t *dst)
+{
+	for(uint32_t y = 0; y < src->height; y++){
+		point_op_negative(IMAGE_VIEW_ROW_U8(src, y), IMAGE_VIEW_ROW_U8(dst, y), src->width);
+	}
+}
+
+void point_op_threshold_view(const image_view_t *src, const image_view_t *dst, uint8_t T)
+{
+	for(uint32_t y = 0; y < src->height; y++){
+		point_op_threshold(IMAGE_VIEW_ROW_U8(src, y), IMAGE_VIEW_ROW_U8(dst, y), src->width, T);
+	}
+}
@@ -0,0 +1,50 @@
+/*
+ * stack_monitor.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include "stack_monitor.h"
+
+extern uint8_t _end;  // Symbol defined in the linker script
+
+static struct {
+	uint32_t cstack;  // stack pointer at mark time
+	uint32_t bstack;  // lowest watched address
+} io_stack;
+
+static inline uint32_t get_sp(void)
+{
+	uint32_t sp;
+	__asm volatile ("mov %0, sp" : "=r" (sp));
+	return sp;
+}
+
+void stack_monitor_mark(uint32_t msize)
+{
+	io_stack.cstack = get_sp() & ~3u;
+	io_stack.bstack = (io_stack.cstack - msize + 3) & ~3u;
+	if(io_stack.bstack < (uint32_t)&_end){
+		io_stack.bstack = ((uint32_t)&_end + 3) & ~3u;
+	}
+
+	// Keep a few words of margin for this function's own frame
+	volatile uint32_t *pw = (volatile uint32_t *)io_stack.bstack;
+	while((uint32_t)pw < io_stack.cstack - 64){
+		*pw++ = STACK_MONITOR_PATTERN;
+	}
+}
+
+uint32_t stack_monitor_evaluate(void)
+{
+	const volatile uint32_t *pr = (const volatile uint32_t *)io_stack.bstack;
+
+	if(*pr != STACK_MONITOR_PATTERN){
+		return STACK_MONITOR_OVERFLOW;
+	}
+	while((uint32_t)pr < io_stack.cstack && *pr == STACK_MONITOR_PATTERN){
+		pr++;
+	}
+	return io_stack.cstack - (uint32_t)pr;
+}
@@ -0,0 +1,195 @@
+"""
+Converts a grayscale image into a C header for the STM32 projects.
+
+The pixel data can be stored raw, run-length encoded (PackBits style) or
+LZ4-style compressed; Inc/image_codec.h has the matching decoder, which
+streams rows into the point operations without decompressing a whole frame.
+
+    python image_to_header.py photo.png Inc/image_lz4.h --name image_lz4 --codec lz4 --size 64x64
+    python image_to_header.py Inc/image.h Inc/image_rle.h --name image_rle --codec rle
+    python image_to_header.py ../HW2/Core/Inc/image_to_process.h ../HW2/Core/Inc/image_to_process_lz4.h --name image_lz4
+
+The input is either an image file (read with OpenCV) or an existing header
+such as Inc/image.h, whose array and *_WIDTH / *_HEIGHT defines are parsed.
+"""
+import argparse
+import os
+import re
+
+LZ4_MIN_MATCH = 4
+DEFAULT_WINDOW = 256  # must not exceed IMAGE_CODEC_WINDOW in image_codec.h
+
+
+# --- Input ---
+def load_header(path):
+    with open(path, encoding="utf-8", errors="ignore") as f:
+        text = f.read()
+    width = int(re.search(r"#define\s+\w*WIDTH\s+(\d+)", text).group(1))
+    height = int(re.search(r"#define\s+\w*HEIGHT\s+(\d+)", text).group(1))
+    body = text[text.index("{", text.index("=")) + 1:]
+    body = body[:body.index("}")]
+    pixels = bytes(int(v) for v in re.findall(r"\d+", body))
+    return pixels, width, height
+
+
+def load_image(path, size):
+    import cv2
+    img = cv2.imread(path, cv2.IMREAD_GRAYSCALE)
+    if img is None:
+        raise SystemExit(f"ERROR: cannot read {path}")
+    if size:
+        img = cv2.resize(img, size, interpolation=cv2.INTER_AREA)
+    return img.tobytes(), img.shape[1], img.shape[0]
+
+
+# --- Encoders ---
+def encode_rle(data):
+    """PackBits: c < 128 -> c + 1 literals follow, c >= 128 -> next byte repeats c - 126 times."""
+    out = bytearray()
+    i, n = 0, len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 129 and data[i + run] == data[i]:
+            run += 1
+        if run >= 2:
+            out += bytes([run + 126, data[i]])
+            i += run
+            continue
+        start = i
+        while i < n and i - start < 128:
+            if i + 1 < n and data[i + 1] == data[i]:
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
+
+
+def lz4_length(n):
+    out = bytearray()
+    while n >= 255:
+        out.append(255)
+        n -= 255
+    out.append(n)
+    return out
+
+
+def encode_lz4(data, window):
+    """LZ4 block format, with match offsets limited to `window` bytes."""
+    out = bytearray()
+    n = len(data)
+    chains = {}
+    anchor = i = 0
+    while i + LZ4_MIN_MATCH <= n:
+        key = data[i:i + LZ4_MIN_MATCH]
+        best_len, best_off = 0, 0
+        for cand in reversed(chains.get(key, ())):
+            if i - cand > window:
+                break
+            length = 0
+            while i + length < n and data[cand + length] == data[i + length]:
+                length += 1
+            if length > best_len:
+                best_len, best_off = length, i - cand
+        chains.setdefault(key, []).append(i)
+        if best_len < LZ4_MIN_MATCH:
+            i += 1
+            continue
+
+        lit = data[anchor:i]
+        ml = best_len - LZ4_MIN_MATCH
+        out.append((min(len(lit), 15) << 4) | min(ml, 15))
+        if len(lit) >= 15:
+            out += lz4_length(len(lit) - 15)
+        out += lit
+        out += bytes([best_off & 0xFF, best_off >> 8])
+        if ml >= 15:
+            out += lz4_length(ml - 15)
+        for k in range(i + 1, i + best_len):
+            if k + LZ4_MIN_MATCH <= n:
+                chains.setdefault(data[k:k + LZ4_MIN_MATCH], []).append(k)
+        i += best_len
+        anchor = i
+
+    lit = data[anchor:]
+    out.append(min(len(lit), 15) << 4)
+    if len(lit) >= 15:
+        out += lz4_length(len(lit) - 15)
+    out += lit
+    return bytes(out)
+
+
+# --- Output ---
+def write_header(path, name, codec, pixels, width, height, section, window):
+    if codec == "raw":
+        payload = pixels
+    elif codec == "rle":
+        payload = encode_rle(pixels)
+    else:
+        payload = encode_lz4(pixels, window)
+
+    guard = re.sub(r"\W", "_", os.path.basename(path)).upper() + "_"
+    lines = [
+        "/*",
+        f" * {os.path.basename(path)}",
+        " *",
+        " *  Generated by image_to_header.py, do not edit.",
+        f" *  {width}x{height} pixels, {codec.upper()}: {len(payload)} bytes"
+        f" ({100.0 * len(payload) / len(pixels):.1f}% of raw)",
+        " */",
+        "",
+        f"#ifndef {guard}",
+        f"#define {guard}",
+        "",
+        "#include <stdint.h>",
+        '#include "image_codec.h"',
+        "",
+        f"static const uint8_t {name}_data[{len(payload)}]",
+        f'\t__attribute__((aligned(4), section("{section}"))) = {{',
+    ]
+    for k in range(0, len(payload), 16):
+        lines.append("  " + ", ".join(str(b) for b in payload[k:k + 16]) + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines += [
+        "};",
+        "",
+        f"static const compressed_image_t {name} = {{",
+        f"\t.codec = IMAGE_CODEC_{codec.upper()},",
+        f"\t.width = {width},",
+        f"\t.height = {height},",
+        f"\t.size = sizeof({name}_data),",
+        f"\t.data = {name}_data,",
+        "};",
+        "",
+        f"#endif /* {guard} */",
+        "",
+    ]
+    with open(path, "w", newline="\n") as f:
+        f.write("\n".join(lines))
+    print(f"{path}: {width}x{height}, {codec}: {len(pixels)} -> {len(payload)} bytes")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", help="image file or existing C header")
+    parser.add_argument("output", help="header to write")
+    parser.add_argument("--name", default="image_packed", help="C identifier of the image")
+    parser.add_argument("--codec", choices=("raw", "rle", "lz4"), default="lz4")
+    parser.add_argument("--size", help="resize to WxH (image input only)")
+    parser.add_argument("--section", default=".rodata.images", help="linker section of the data")
+    parser.add_argument("--window", type=int, default=DEFAULT_WINDOW, help="LZ4 match window in bytes")
+    args = parser.parse_args()
+
+    if args.input.endswith(".h"):
+        pixels, width, height = load_header(args.input)
+    else:
+        size = tuple(int(v) for v in args.size.lower().split("x")) if args.size else None
+        pixels, width, height = load_image(args.input, size)
+    if len(pixels) != width * height:
+        raise SystemExit(f"ERROR: {len(pixels)} pixels, expected {width}x{height}")
+
+    write_header(args.output, args.name, args.codec, pixels, width, height, args.section, args.window)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+/*
+ * clahe.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef CLAHE_H_
+#define CLAHE_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "histogram.h"
+
+/*
+ * Contrast-limited adaptive histogram equalization. The frame is cut into
+ * tiles_x x tiles_y tiles, and every tile gets its own 256-entry mapping
+ * table from its histogram. Before the table is built, each bin is clipped
+ * to clip_limit_q8 / 256 times the mean bin count, and the clipped counts
+ * are spread evenly over all bins, which bounds the contrast gain in flat,
+ * noisy regions. Everything is integer.
+ *
+ * A pixel is mapped by the tables of the four tiles whose centres surround
+ * it, blended bilinearly with 8-bit weights; pixels outside the outer tile
+ * centres use the nearest tiles only. The mapping needs nothing but the
+ * tables, so clahe_map_row() can run on rows as they stream in, and
+ * clahe_apply() can work in place.
+ *
+ * Tile edges are at i * width / tiles_x, so the width and height do not have
+ * to be multiples of the grid.
+ */
+#define CLAHE_MAX_TILES 16
+#define CLAHE_LEVELS 256
+
+// Clip limit in units of the mean bin count, e.g. CLAHE_CLIP_Q8(2.0); 0 disables clipping
+#define CLAHE_CLIP_Q8(limit) ((uint16_t)((limit) * 256.0f + 0.5f))
+
+// Tables and per-column blend weights: 64x64 with 4x4 tiles takes 4.2 KB
+#define CLAHE_WORKSPACE_SIZE(width, tiles_x, tiles_y) \
+    ((uint32_t)(tiles_x) * (tiles_y) * CLAHE_LEVELS + 2 * (uint32_t)(width))
+
+typedef struct {
+    uint32_t hist[HISTOGRAM_BINS];  // clahe_build(): one tile at a time
+    uint16_t width;
+    uint16_t height;
+    uint8_t tiles_x;
+    uint8_t tiles_y;
+    uint16_t clip_limit_q8;
+    uint8_t *luts;          // tiles_x * tiles_y tables, row-major
+    uint8_t *col_tile;      // per column: left tile of the blend
+    uint8_t *col_weight;    // per column: weight of the right tile, 0..255
+} clahe_t;
+
+/*
+ * workspace holds CLAHE_WORKSPACE_SIZE(width, tiles_x, tiles_y) bytes.
+ * Returns 0, or -1 if the grid is empty, above CLAHE_MAX_TILES or has more
+ * tiles than pixels on a side.
+ */
+int clahe_init(clahe_t *c, uint16_t width, uint16_t height, uint8_t tiles_x, uint8_t tiles_y,
+               uint16_t clip_limit_q8, uint8_t *workspace);
+
+/* Builds every tile's table from src, which has the planned size.
+ * hist_sub is the histogram_u8() workspace, HISTOGRAM_SUB_WORDS words; it
+ * is only used during the call and may be shared with other histograms. */
+void clahe_build(clahe_t *c, const image_view_t *src, uint32_t *hist_sub);
+
+// Maps row y; src and dst may be the same row
+void clahe_map_row(const clahe_t *c, uint32_t y, const uint8_t *src, uint8_t *dst);
+
+// clahe_build() on src, then clahe_map_row() for every row; src == dst is allowed
+void clahe_apply(clahe_t *c, const image_view_t *src, const image_view_t *dst, uint32_t *hist_sub);
+
+#endif /* CLAHE_H_ */
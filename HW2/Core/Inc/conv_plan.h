@@ -0,0 +1,88 @@
+/*
+ * conv_plan.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef CONV_PLAN_H_
+#define CONV_PLAN_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "real_fft.h"
+
+/*
+ * Convolution front-end that looks at the kernel once and picks how to
+ * apply it:
+ *   - CONV_SEPARABLE: the kernel is rank 1 (column x row, e.g. box or
+ *     Gaussian), so it runs as a horizontal and a vertical 1-D pass,
+ *     2k instead of k*k multiply-adds per pixel.
+ *   - CONV_FFT: large non-separable kernels. Every source row and kernel
+ *     row is transformed once with a real FFT; an output row is the inverse
+ *     FFT of the sum of the k row spectra times the kernel row spectra.
+ *     Only 1-D real FFTs are needed, so on the MCU this is CMSIS-DSP's
+ *     arm_rfft_fast_f32() (see real_fft.h).
+ *   - CONV_DIRECT: apply_2d_convolution().
+ * Borders are replicated like apply_2d_convolution(). The separable and
+ * FFT sums are rounded differently, so a pixel whose exact value is within
+ * float error of a .5 tie can differ by one level.
+ *
+ * The thresholds are the crossovers measured by host/bench_conv_strategy.c
+ * on a 640x480 frame: at 3x3 separable runs at 0.8-0.9x of direct, at 5x5
+ * at 1.2x; FFT runs at 0.8-0.9x at 7x7 and 1.4-1.6x at 9x9. Targets can
+ * override them at compile time, e.g. with the Cortex-M4 numbers of
+ * benchmark_conv_plan() in main.c.
+ */
+#ifndef CONV_SEPARABLE_MIN_KERNEL
+#define CONV_SEPARABLE_MIN_KERNEL 5
+#endif
+#ifndef CONV_FFT_MIN_KERNEL
+#define CONV_FFT_MIN_KERNEL 9
+#endif
+#define CONV_PLAN_MAX_KERNEL 31
+
+typedef enum {
+    CONV_AUTO = -1,     // conv_plan_init() only: choose from the kernel
+    CONV_DIRECT,
+    CONV_SEPARABLE,
+    CONV_FFT
+} conv_strategy_t;
+
+typedef struct {
+    conv_strategy_t strategy;
+    const float *kernel;
+    int size;
+    uint16_t width;
+    float row[CONV_PLAN_MAX_KERNEL];    // separable factors, kernel = col x row
+    float col[CONV_PLAN_MAX_KERNEL];
+    real_fft_t fft;
+    uint32_t fft_size;
+    float *spectra;     // FFT: kernel row spectra, size * fft_size
+    float *ring;        // source rows (filtered or transformed), size rows
+    float *scratch;     // FFT: two fft_size buffers
+} conv_plan_t;
+
+// Upper bound of the FFT size for a row of `width` pixels
+#define CONV_PLAN_FFT_BOUND(width, k) \
+    ((2 * ((uint32_t)(width) + (k)) > REAL_FFT_MIN_SIZE) ? 2 * ((uint32_t)(width) + (k)) : REAL_FFT_MIN_SIZE)
+// Floats of workspace for any strategy
+#define CONV_PLAN_WORKSPACE_FLOATS(width, k) ((2 * (uint32_t)(k) + 3) * CONV_PLAN_FFT_BOUND(width, k))
+
+// Factors a rank-1 kernel into col x row; returns 1 if it is separable
+int conv_kernel_separable(const float *kernel, int size, float *row, float *col);
+
+/*
+ * Plans a size x size kernel for rows of `width` pixels. strategy is
+ * CONV_AUTO or a strategy to force (benchmarks). workspace holds
+ * CONV_PLAN_WORKSPACE_FLOATS(width, size) floats and must stay valid while
+ * the plan is used. Returns the chosen strategy, or -1 if a forced one is
+ * not possible for this kernel or size.
+ */
+int conv_plan_init(conv_plan_t *p, const float *kernel, int size, uint16_t width,
+                   conv_strategy_t strategy, float *workspace);
+
+// src->width must be the planned width
+void conv_plan_apply(const conv_plan_t *p, const image_view_t *src, const image_view_t *dst);
+
+#endif /* CONV_PLAN_H_ */
@@ -0,0 +1,47 @@
+/*
+ * conv_q15.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef CONV_Q15_H_
+#define CONV_Q15_H_
+
+#include <stdint.h>
+#include "image_view.h"
+
+/*
+ * Fixed-point 2D convolution for 8-bit views.
+ *
+ * conv_q15_init() quantizes a float kernel to 16-bit coefficients with
+ * frac_bits fractional bits: 15 (Q15) when every |coefficient| < 1, fewer
+ * when the kernel has larger taps such as the 8 of the high-pass kernel.
+ * Each kernel row is padded to an even length and stored as coefficient
+ * pairs, so one SMLAD multiplies two pixels by two taps and accumulates.
+ * Without the DSP extension, a C version of SMLAD is used.
+ *
+ * Borders are replicated and the result is rounded to nearest and clamped
+ * to 0..255, like apply_2d_convolution().
+ */
+#define CONV_Q15_MAX_SIZE  7
+#define CONV_Q15_PAIRS     ((CONV_Q15_MAX_SIZE + 1) / 2)
+
+// int16_t entries needed by the row buffer of apply_2d_convolution_q15()
+#define CONV_Q15_ROWS_SIZE(width, kernel_size) \
+    ((uint32_t)(kernel_size) * ((uint32_t)(width) + (kernel_size) + 1))
+
+typedef struct {
+    uint32_t pairs[CONV_Q15_MAX_SIZE][CONV_Q15_PAIRS];   // (tap i + 1) << 16 | tap i
+    uint8_t size;
+    uint8_t frac_bits;
+} conv_q15_t;
+
+// Returns 0, or -1 if kernel_size is even or above CONV_Q15_MAX_SIZE
+int conv_q15_init(conv_q15_t *q, const float *kernel, int kernel_size);
+
+// rows holds CONV_Q15_ROWS_SIZE(src->width, q->size) entries
+void apply_2d_convolution_q15(const conv_q15_t *q, const image_view_t *src,
+                              const image_view_t *dst, int16_t *rows);
+
+#endif /* CONV_Q15_H_ */
@@ -0,0 +1,74 @@
+/*
+ * equalization.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef EQUALIZATION_H_
+#define EQUALIZATION_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "histogram.h"
+
+#define EQUALIZE_LEVELS 256
+
+/*
+ * Histogram equalization as a 256-entry mapping table. The table is built
+ * once from the histogram with integer arithmetic only, and equalizing an
+ * image is then one lookup per pixel.
+ *
+ * With C the cumulative histogram, C_min its first non-zero value and N the
+ * pixel count, level r maps to
+ *     round(255 * (C[r] - C_min) / (N - C_min)),   0 for C[r] <= C_min,
+ * rounded exactly (halves up) for any N.
+ */
+void equalize_lut(const uint32_t *histogram, uint32_t total, uint8_t *lut);
+void equalize_apply(const uint8_t *lut, const image_view_t *src, const image_view_t *dst);
+
+/*
+ * Float reference with the arithmetic of the original equalization loop.
+ * The two tables are not bit-exact. equalize_lut() is the correctly rounded
+ * one, and the contract between them is:
+ *   - up to EQUALIZE_FLOAT_MAX_PIXELS, entries differ by at most one level,
+ *     and only where the exact value is within
+ *     EQUALIZE_FLOAT_TIE_BAND / (1 - C_min / N) of a .5 tie;
+ *   - above it, 1/N falls below float resolution near 1 and the float
+ *     table is not meaningful.
+ * The band is 255 times the error of 256 float additions of values up to 1,
+ * 2^-24 each. host/check_equalization.c checks the contract over a corpus.
+ */
+#define EQUALIZE_FLOAT_MAX_PIXELS (1u << 23)
+#define EQUALIZE_FLOAT_TIE_BAND 0.004
+
+void equalize_lut_float(const uint32_t *histogram, uint32_t total, uint8_t *lut);
+
+/*
+ * Temporal equalization for frame streams. Frame N is mapped with the table
+ * built from frame N-1 while its own histogram is collected, so each row
+ * can be output as soon as it has been read: one pass, one row of latency
+ * and no frame buffer. The first frame passes through unchanged.
+ *
+ * With new_weight_q8 below 256, the table is smoothed over frames,
+ *     T = T + new_weight_q8 / 256 * (T_new - T),
+ * kept in Q8, so a sudden change in the scene fades in over a few frames
+ * instead of flickering. 256 uses each frame's table as it is.
+ */
+typedef struct {
+    uint8_t lut[EQUALIZE_LEVELS];          // maps the current frame
+    uint16_t smoothed[EQUALIZE_LEVELS];    // Q8 table behind lut
+    uint32_t histogram[EQUALIZE_LEVELS];   // current frame so far
+    uint16_t new_weight_q8;
+    uint32_t frames;                       // completed frames
+} equalize_temporal_t;
+
+void equalize_temporal_init(equalize_temporal_t *t, uint16_t new_weight_q8);
+
+// Maps one row with the current table and counts it for the next one
+void equalize_temporal_row(equalize_temporal_t *t, const uint8_t *src, uint8_t *dst, uint32_t width);
+
+// After the last row: builds the table for the next frame and clears the histogram
+void equalize_temporal_end_frame(equalize_temporal_t *t);
+
+#endif /* EQUALIZATION_H_ */
@@ -0,0 +1,61 @@
+/*
+ * filter_graph.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef FILTER_GRAPH_H_
+#define FILTER_GRAPH_H_
+
+#include <stdint.h>
+
+#define GRAPH_MAX_INPUTS 2
+#define GRAPH_MAX_OUTPUTS 2
+#define GRAPH_MAX_STAGES 32
+
+/*
+ * Small dependency-tracked executor. Every image or table a stage reads or
+ * writes is a graph_buffer_t whose version changes whenever its contents
+ * do. A stage runs only if it has never run or one of its inputs has a
+ * different version from when it last ran; after running, the version of
+ * every output is bumped so the stages that read them run too.
+ *
+ * filter_graph_run() orders the stages by their inputs and outputs, so
+ * they can be listed in any order, and each one runs at most once per call.
+ */
+typedef struct {
+    void *data;
+    uint32_t version;
+} graph_buffer_t;
+
+typedef struct {
+    const char *name;
+    void (*run)(void *ctx);
+    void *ctx;
+    graph_buffer_t *inputs[GRAPH_MAX_INPUTS];
+    uint8_t num_inputs;
+    graph_buffer_t *outputs[GRAPH_MAX_OUTPUTS];
+    uint8_t num_outputs;
+    // Executor state
+    uint32_t seen[GRAPH_MAX_INPUTS];   // input versions at the last run
+    uint8_t has_run;
+} filter_stage_t;
+
+typedef struct {
+    filter_stage_t *stages;
+    uint32_t count;      // up to GRAPH_MAX_STAGES
+    uint32_t executed;   // totals over all filter_graph_run() calls
+    uint32_t skipped;
+} filter_graph_t;
+
+// Marks a buffer changed, e.g. after a new frame is written to a source
+static inline void graph_buffer_touch(graph_buffer_t *b)
+{
+    b->version++;
+}
+
+// Returns 0, or -1 if the stages form a cycle (the stages on it are not run)
+int filter_graph_run(filter_graph_t *g);
+
+#endif /* FILTER_GRAPH_H_ */
@@ -0,0 +1,37 @@
+/*
+ * histogram.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef HISTOGRAM_H_
+#define HISTOGRAM_H_
+
+#include <stdint.h>
+#include "image_view.h"
+
+#define HISTOGRAM_BINS 256
+
+// Words of workspace for the three extra sub-histograms (3 KB)
+#define HISTOGRAM_SUB_WORDS (3 * HISTOGRAM_BINS)
+
+/*
+ * 8-bit histogram with four interleaved sub-histograms. Pixels are read
+ * one 32-bit word (4 pixels) at a time and pixel k of each word is counted
+ * in sub-histogram k, so equal neighbouring pixels, as in flat regions or
+ * binary images, increment different counters and do not wait on each
+ * other's read-modify-write. The sub-histograms are merged once at the end.
+ *
+ * Sub-histogram 0 is the caller's histogram; the other three live in sub,
+ * HISTOGRAM_SUB_WORDS words owned by the caller. The functions keep no
+ * state, so callers with their own sub can run them concurrently.
+ */
+
+// Clears histogram and counts every pixel of the view
+void histogram_u8(const image_view_t *v, uint32_t *histogram, uint32_t *sub);
+
+// Adds the counts of size pixels to histogram
+void histogram_u8_add(const uint8_t *data, uint32_t size, uint32_t *histogram, uint32_t *sub);
+
+#endif /* HISTOGRAM_H_ */
@@ -0,0 +1,63 @@
+/*
+ * image_codec.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef IMAGE_CODEC_H_
+#define IMAGE_CODEC_H_
+
+#include <stdint.h>
+
+/*
+ * Compressed images produced by image_to_header.py.
+ *   RAW: plain pixels
+ *   RLE: PackBits, c < 128 -> c + 1 literal bytes, c >= 128 -> next byte
+ *        repeated c - 126 times
+ *   LZ4: LZ4 block format with match offsets limited to IMAGE_CODEC_WINDOW
+ *
+ * The decoder is a resumable state machine: each image_decoder_read() call
+ * produces the next `len` pixels, so rows can be fed to the kernels as they
+ * are decoded. Its only buffer is the LZ4 history window. This is the HW1
+ * decoder; here it feeds stream_pipeline_run() instead of the point ops.
+ */
+#define IMAGE_CODEC_WINDOW 256  // power of two, >= the generator's --window
+
+typedef enum {
+	IMAGE_CODEC_RAW,
+	IMAGE_CODEC_RLE,
+	IMAGE_CODEC_LZ4
+} image_codec_t;
+
+typedef struct {
+	image_codec_t codec;
+	uint16_t width;
+	uint16_t height;
+	uint32_t size;        // compressed bytes
+	const uint8_t *data;
+} compressed_image_t;
+
+typedef struct {
+	const compressed_image_t *img;
+	uint32_t in_pos;      // next compressed byte
+	uint32_t out_pos;     // pixels produced so far
+	uint32_t lit_left;    // literal bytes left in the current RLE/LZ4 sequence
+	uint32_t run_left;    // RLE repeat or LZ4 match bytes left
+	uint32_t offset;      // LZ4 match distance
+	uint32_t match_len;   // LZ4 match length of the current sequence
+	uint8_t run_value;    // RLE repeated byte
+	uint8_t match_pending;
+	uint8_t window[IMAGE_CODEC_WINDOW];
+} image_decoder_t;
+
+void image_decoder_init(image_decoder_t *dec, const compressed_image_t *img);
+// Returns the number of pixels written, less than len only at the end or on corrupt data
+uint32_t image_decoder_read(image_decoder_t *dec, uint8_t *dst, uint32_t len);
+
+/* stream_source_t adapter for stream_pipeline_run(), ctx is an image_decoder_t
+ * initialized on the image. Rows must be pulled in order, as the pipeline
+ * does; returns -1 if the data ends before the row. */
+int image_decoder_row_source(void *ctx, uint32_t y, uint8_t *row, uint16_t width);
+
+#endif /* IMAGE_CODEC_H_ */
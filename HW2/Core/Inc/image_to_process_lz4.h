@@ -0,0 +1,114 @@
+/*
+ * image_to_process_lz4.h
+ *
+ *  Generated by image_to_header.py, do not edit.
+ *  64x64 pixels, LZ4: 1403 bytes (34.3% of raw)
+ */
+
+#ifndef IMAGE_TO_PROCESS_LZ4_H_
+#define IMAGE_TO_PROCESS_LZ4_H_
+
+#include <stdint.h>
+#include "image_codec.h"
+
+static const uint8_t image_lz4_data[1403]
+	__attribute__((aligned(4), section(".rodata.images"))) = {
+  16, 146, 1, 0, 31, 182, 1, 0, 31, 1, 56, 0, 6, 1, 0, 15,
+  62, 0, 43, 15, 129, 0, 30, 15, 62, 0, 43, 12, 65, 0, 47, 182,
+  182, 67, 0, 32, 15, 128, 0, 56, 15, 65, 0, 31, 15, 255, 0, 60,
+  15, 191, 0, 66, 79, 109, 73, 73, 109, 92, 0, 5, 15, 127, 0, 16,
+  32, 36, 0, 1, 0, 31, 73, 64, 0, 38, 1, 63, 0, 79, 0, 0,
+  36, 109, 64, 0, 35, 19, 73, 64, 0, 47, 0, 36, 64, 0, 11, 15,
+  126, 0, 4, 3, 191, 0, 79, 0, 36, 0, 36, 35, 0, 1, 15, 127,
+  0, 14, 223, 146, 0, 0, 36, 73, 0, 36, 146, 146, 73, 36, 36, 73,
+  190, 0, 9, 15, 65, 0, 4, 16, 109, 250, 0, 171, 36, 109, 146, 73,
+  109, 73, 73, 73, 73, 109, 37, 0, 15, 62, 0, 9, 81, 146, 109, 109,
+  109, 109, 254, 0, 17, 109, 55, 0, 95, 36, 109, 146, 146, 73, 64, 0,
+  23, 1, 58, 0, 0, 249, 0, 255, 0, 73, 73, 36, 73, 146, 146, 109,
+  73, 36, 73, 109, 36, 73, 109, 109, 192, 0, 5, 14, 248, 0, 3, 64,
+  0, 192, 182, 109, 36, 0, 73, 109, 109, 109, 36, 36, 36, 36, 137, 0,
+  8, 66, 0, 15, 64, 0, 6, 5, 63, 0, 144, 0, 0, 146, 146, 73,
+  0, 0, 73, 182, 64, 0, 103, 73, 36, 109, 109, 73, 36, 43, 0, 15,
+  64, 0, 5, 22, 109, 63, 0, 112, 0, 73, 73, 36, 0, 0, 109, 64,
+  0, 0, 202, 0, 15, 0, 1, 18, 4, 252, 0, 2, 193, 0, 17, 36,
+  198, 0, 122, 182, 73, 73, 73, 73, 0, 0, 104, 0, 15, 64, 0, 3,
+  0, 49, 0, 10, 64, 0, 128, 73, 73, 109, 146, 73, 146, 182, 182, 72,
+  0, 15, 64, 0, 4, 6, 65, 0, 10, 63, 0, 1, 195, 0, 140, 0,
+  0, 109, 146, 146, 219, 255, 182, 192, 0, 15, 129, 0, 1, 15, 63, 0,
+  2, 159, 0, 36, 182, 219, 219, 219, 109, 0, 109, 127, 0, 6, 4, 65,
+  0, 31, 109, 63, 0, 2, 107, 0, 0, 109, 73, 146, 109, 191, 0, 10,
+  63, 0, 3, 64, 0, 13, 127, 0, 18, 73, 18, 0, 1, 6, 0, 6,
+  191, 0, 16, 146, 2, 0, 15, 64, 0, 1, 2, 110, 0, 6, 1, 0,
+  19, 36, 81, 0, 17, 73, 9, 0, 8, 124, 0, 15, 64, 0, 3, 25,
+  146, 129, 0, 6, 13, 0, 32, 109, 36, 26, 0, 2, 37, 0, 3, 48,
+  0, 15, 62, 0, 0, 11, 65, 0, 10, 11, 0, 19, 36, 63, 0, 1,
+  57, 0, 12, 0, 1, 5, 64, 0, 8, 65, 0, 20, 36, 190, 0, 48,
+  0, 0, 36, 217, 0, 4, 38, 0, 15, 64, 0, 10, 47, 182, 109, 129,
+  0, 0, 118, 36, 36, 182, 36, 36, 0, 73, 255, 0, 15, 64, 0, 8,
+  0, 106, 0, 12, 1, 0, 127, 36, 36, 182, 109, 182, 73, 36, 128, 0,
+  18, 7, 246, 0, 2, 1, 0, 187, 146, 73, 0, 36, 0, 219, 146, 182,
+  146, 0, 109, 128, 0, 3, 77, 0, 10, 0, 1, 13, 124, 0, 112, 182,
+  182, 36, 36, 73, 219, 146, 7, 0, 95, 182, 182, 219, 182, 146, 128, 0,
+  11, 13, 191, 0, 96, 109, 182, 182, 0, 73, 109, 128, 0, 37, 73, 0,
+  114, 0, 12, 64, 0, 5, 69, 0, 13, 127, 0, 80, 0, 146, 182, 146,
+  36, 64, 0, 90, 146, 73, 109, 0, 73, 192, 0, 6, 1, 0, 65, 109,
+  109, 109, 109, 64, 0, 13, 127, 0, 96, 73, 182, 182, 109, 36, 109, 64,
+  0, 16, 109, 129, 0, 3, 130, 0, 15, 64, 0, 6, 14, 127, 0, 81,
+  219, 219, 73, 36, 182, 192, 0, 36, 146, 146, 129, 0, 4, 199, 0, 7,
+  64, 0, 1, 6, 0, 45, 73, 36, 64, 0, 81, 182, 182, 182, 36, 73,
+  64, 0, 84, 182, 182, 146, 36, 0, 48, 0, 2, 137, 0, 1, 72, 0,
+  0, 124, 0, 19, 73, 1, 0, 13, 63, 0, 146, 36, 146, 146, 109, 0,
+  73, 109, 73, 219, 55, 0, 146, 0, 73, 73, 73, 36, 109, 182, 73, 73,
+  174, 0, 1, 63, 0, 4, 60, 0, 63, 73, 73, 109, 64, 0, 0, 0,
+  1, 0, 16, 73, 130, 0, 0, 40, 0, 49, 109, 36, 36, 6, 0, 0,
+  24, 0, 1, 203, 0, 0, 52, 0, 0, 20, 0, 0, 132, 0, 0, 135,
+  0, 14, 255, 0, 48, 146, 146, 73, 32, 0, 49, 73, 109, 146, 66, 0,
+  0, 129, 0, 17, 109, 85, 0, 48, 0, 36, 109, 27, 0, 32, 109, 36,
+  100, 0, 125, 109, 146, 146, 109, 109, 146, 146, 255, 0, 208, 73, 219, 219,
+  219, 36, 73, 109, 73, 73, 146, 73, 36, 146, 102, 0, 33, 0, 36, 238,
+  0, 1, 141, 0, 0, 10, 0, 18, 109, 77, 0, 16, 109, 221, 0, 45,
+  146, 109, 127, 0, 128, 73, 146, 146, 146, 0, 73, 109, 109, 192, 0, 0,
+  36, 0, 49, 146, 73, 0, 7, 0, 15, 1, 0, 3, 14, 191, 0, 0,
+  152, 0, 16, 0, 188, 0, 20, 182, 36, 0, 1, 83, 0, 12, 1, 0,
+  3, 84, 0, 13, 191, 0, 18, 36, 255, 0, 64, 109, 146, 73, 182, 225,
+  0, 96, 109, 146, 109, 109, 36, 0, 184, 0, 12, 1, 0, 1, 69, 0,
+  15, 191, 0, 3, 96, 36, 73, 36, 146, 146, 109, 192, 0, 2, 65, 0,
+  0, 207, 0, 15, 64, 0, 2, 45, 146, 109, 192, 0, 0, 24, 0, 66,
+  0, 73, 73, 146, 0, 1, 2, 65, 0, 47, 36, 36, 64, 0, 5, 59,
+  146, 146, 109, 194, 0, 2, 241, 0, 16, 109, 128, 0, 5, 234, 0, 17,
+  109, 86, 0, 0, 206, 0, 14, 64, 0, 46, 146, 146, 255, 0, 55, 0,
+  73, 146, 32, 0, 64, 146, 109, 146, 36, 214, 0, 15, 64, 0, 4, 40,
+  109, 0, 130, 0, 0, 41, 0, 0, 126, 0, 9, 1, 0, 0, 142, 0,
+  13, 65, 0, 15, 64, 0, 3, 0, 23, 0, 32, 36, 73, 70, 0, 0,
+  10, 0, 3, 38, 0, 77, 109, 109, 0, 73, 125, 0, 16, 109, 79, 0,
+  1, 221, 0, 7, 65, 0, 16, 36, 29, 0, 36, 0, 73, 46, 0, 3,
+  98, 0, 74, 109, 109, 73, 0, 64, 0, 18, 109, 35, 0, 2, 128, 0,
+  37, 0, 36, 65, 0, 0, 22, 0, 28, 73, 64, 0, 1, 37, 0, 1,
+  147, 0, 13, 1, 0, 64, 146, 109, 146, 73, 64, 0, 4, 66, 0, 3,
+  64, 0, 6, 30, 0, 4, 1, 0, 28, 36, 129, 0, 5, 93, 0, 2,
+  64, 0, 17, 73, 190, 0, 1, 191, 0, 34, 73, 36, 64, 0, 5, 255,
+  0, 1, 121, 0, 31, 36, 126, 0, 0, 2, 202, 0, 1, 64, 0, 18,
+  109, 64, 0, 0, 43, 0, 32, 73, 219, 57, 0, 2, 64, 0, 4, 135,
+  0, 79, 109, 109, 109, 182, 61, 0, 1, 0, 47, 0, 16, 36, 64, 0,
+  16, 146, 194, 0, 48, 36, 73, 146, 209, 0, 32, 255, 182, 48, 0, 6,
+  112, 0, 0, 199, 0, 8, 16, 0, 5, 191, 0, 1, 100, 0, 32, 73,
+  0, 65, 0, 1, 64, 0, 2, 249, 0, 4, 128, 0, 2, 50, 0, 5,
+  55, 0, 29, 73, 129, 0, 2, 27, 0, 1, 64, 0, 22, 73, 64, 0,
+  52, 73, 109, 219, 254, 0, 2, 6, 0, 4, 200, 0, 12, 129, 0, 3,
+  17, 0, 1, 191, 0, 80, 109, 146, 36, 73, 36, 8, 0, 66, 109, 109,
+  73, 146, 105, 0, 5, 64, 0, 5, 66, 0, 15, 197, 0, 0, 32, 109,
+  109, 121, 0, 0, 56, 0, 0, 62, 0, 0, 128, 0, 52, 146, 36, 219,
+  113, 0, 6, 234, 0, 6, 193, 0, 7, 28, 0, 16, 146, 2, 0, 21,
+  146, 64, 0, 64, 0, 36, 73, 36, 192, 0, 17, 36, 191, 0, 15, 1,
+  0, 2, 32, 146, 109, 33, 0, 3, 1, 0, 0
+};
+
+static const compressed_image_t image_lz4 = {
+	.codec = IMAGE_CODEC_LZ4,
+	.width = 64,
+	.height = 64,
+	.size = sizeof(image_lz4_data),
+	.data = image_lz4_data,
+};
+
+#endif /* IMAGE_TO_PROCESS_LZ4_H_ */
@@ -0,0 +1,69 @@
+/*
+ * pipeline.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef PIPELINE_H_
+#define PIPELINE_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "equalization.h"
+
+/*
+ * Lazy point -> 3x3 neighbourhood -> point pipeline on 8-bit views.
+ *
+ * A pipeline is only a description. pipeline_run() evaluates it in one
+ * pass: the load LUT is applied as each source row enters a 3-row line
+ * buffer, the neighbourhood operation reads the line buffer, and the store
+ * LUT is applied to its result before the single store to dst. The
+ * intermediate images never exist in RAM. For example
+ * median3(equalize(img)) > otsu becomes
+ *     { .load_lut = eq_lut, .op = PIPELINE_MEDIAN3, .store_lut = otsu_lut }.
+ *
+ * Borders are replicated like apply_2d_convolution(), and the result is
+ * byte-identical to running the stages one after the other.
+ */
+#define PIPELINE_KERNEL_SIZE 3
+#define PIPELINE_LINE_BUFFER_SIZE(width) (PIPELINE_KERNEL_SIZE * (uint32_t)(width))
+
+typedef enum {
+    PIPELINE_NONE,      // point operations only
+    PIPELINE_MEDIAN3,
+    PIPELINE_CONV3      // float 3x3 kernel, rounded and clamped
+} pipeline_op_t;
+
+typedef struct {
+    const uint8_t *load_lut;    // applied to source pixels, NULL for identity
+    pipeline_op_t op;
+    const float *kernel;        // PIPELINE_CONV3 only
+    const uint8_t *store_lut;   // applied to results, NULL for identity
+    uint32_t *histogram;        // if not NULL, 256 bins of the results are added here
+} pipeline_t;
+
+/*
+ * Image traffic: bytes read from the source and full-size intermediate
+ * images, bytes written to dst and full-size intermediates, and the largest
+ * pixel buffer needed besides src and dst.
+ */
+typedef struct {
+    uint32_t bytes_read;
+    uint32_t bytes_written;
+    uint32_t buffer_bytes;
+} pipeline_stats_t;
+
+/*
+ * line_buf holds PIPELINE_LINE_BUFFER_SIZE(src->width) bytes. dst may be
+ * NULL when only the histogram is wanted. stats, if not NULL, is added to.
+ */
+void pipeline_run(const pipeline_t *p, const image_view_t *src, const image_view_t *dst,
+                  uint8_t *line_buf, pipeline_stats_t *stats);
+
+// Point operations built from a histogram, usable as pipeline LUTs
+// (histogram_u8() is in histogram.h, equalize_lut() in equalization.h)
+uint8_t otsu_threshold(const uint32_t *histogram, uint32_t total);
+void threshold_lut(uint8_t threshold, uint8_t *lut);
+
+#endif /* PIPELINE_H_ */
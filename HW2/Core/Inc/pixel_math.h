@@ -0,0 +1,38 @@
+/*
+ * pixel_math.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef PIXEL_MATH_H_
+#define PIXEL_MATH_H_
+
+#include <stdint.h>
+
+/*
+ * Border and rounding rules shared by every 8-bit filter path
+ * (spatial_filters.c, pipeline.c, stream_pipeline.c, conv_q15.c,
+ * conv_plan.c). Their outputs are byte-identical only because they all
+ * use these two functions.
+ */
+
+// Replicated border: an index outside 0..n-1 takes the nearest edge
+static inline int clamp_index(int v, int n)
+{
+    if (v < 0) return 0;
+    if (v >= n) return n - 1;
+    return v;
+}
+
+// Convolution sum to a pixel: rounded half up, clamped to 0..255
+static inline uint8_t store_u8(float sum)
+{
+    int result = (int)(sum + 0.5f);
+
+    if (result < 0) result = 0;
+    if (result > 255) result = 255;
+    return (uint8_t)result;
+}
+
+#endif /* PIXEL_MATH_H_ */
@@ -0,0 +1,52 @@
+/*
+ * real_fft.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef REAL_FFT_H_
+#define REAL_FFT_H_
+
+#include <stdint.h>
+
+#if defined(ARM_MATH_CM4)
+#include "arm_math.h"
+#endif
+
+/*
+ * Real FFT of a power-of-two size N. With CMSIS-DSP (ARM_MATH_CM4 defined
+ * and the library linked) it is arm_rfft_fast_f32(); otherwise a radix-2
+ * FFT of N/2 complex points plus a split step. Both use the CMSIS packed
+ * spectrum layout:
+ *     out[0] = X[0], out[1] = X[N/2] (both real),
+ *     out[2k], out[2k + 1] = Re X[k], Im X[k] for 0 < k < N/2,
+ * and the inverse returns the original signal (scaled by 1/N). As with
+ * CMSIS, both directions overwrite their input.
+ */
+#define REAL_FFT_MIN_SIZE 32
+#if defined(ARM_MATH_CM4)
+#define REAL_FFT_MAX_SIZE 4096          // arm_rfft_fast_f32 limit
+#else
+#define REAL_FFT_MAX_SIZE 65536
+#endif
+#define REAL_FFT_TWIDDLE_FLOATS(n) (n)  // own FFT only
+
+typedef struct {
+    uint32_t size;
+#if defined(ARM_MATH_CM4)
+    arm_rfft_fast_instance_f32 cmsis;
+#else
+    const float *twiddles;  // e^(-2 pi i k / N), k < N/2, as re/im pairs
+#endif
+} real_fft_t;
+
+// twiddles holds REAL_FFT_TWIDDLE_FLOATS(size) floats; returns 0, or -1 for an unsupported size
+int real_fft_init(real_fft_t *f, uint32_t size, float *twiddles);
+void real_fft_forward(const real_fft_t *f, float *in, float *out);
+void real_fft_inverse(const real_fft_t *f, float *in, float *out);
+
+// acc += a * b, bin by bin, for spectra in the packed layout
+void real_fft_multiply_add(const float *a, const float *b, float *acc, uint32_t size);
+
+#endif /* REAL_FFT_H_ */
@@ -0,0 +1,97 @@
+/*
+ * row_transport.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef ROW_TRANSPORT_H_
+#define ROW_TRANSPORT_H_
+
+#include <stdint.h>
+
+/*
+ * Full-duplex row streaming over a UART. Rows are received by interrupt
+ * into a ring of ROW_TRANSPORT_RX_ROWS rows, so the next row keeps arriving
+ * while the current one is processed, and output rows are queued in a ring
+ * of ROW_TRANSPORT_TX_ROWS rows and sent while the next ones are computed.
+ * The sender needs no handshake as long as a row is processed in less time
+ * than it takes to receive one; a burst of slower rows is absorbed by the
+ * receive ring.
+ *
+ * Hardware is reached only through row_port_t: HAL interrupt transfers on
+ * the board (HW2 main.c). row_transport_rx_complete(), _tx_complete() and
+ * _error() run in the interrupt; the others in the main loop. A transfer
+ * that could not be started is retried by the next read() or write().
+ */
+#define ROW_TRANSPORT_RX_ROWS 4
+#define ROW_TRANSPORT_TX_ROWS 4
+
+// Bytes of the buffer given to row_transport_init()
+#define ROW_TRANSPORT_BUFFER_SIZE(width) \
+    ((uint32_t)(ROW_TRANSPORT_RX_ROWS + ROW_TRANSPORT_TX_ROWS) * (uint32_t)(width))
+
+// row_transport_error(): directions stopped by the error
+#define ROW_ERROR_RX 0x1u
+#define ROW_ERROR_TX 0x2u
+
+typedef struct {
+    int (*start_receive)(void *ctx, uint8_t *buf, uint32_t size);      // 0: started
+    int (*start_transmit)(void *ctx, const uint8_t *buf, uint32_t size);
+    void (*abort_receive)(void *ctx);
+    void (*lock)(void *ctx);        // disable interrupts
+    void (*unlock)(void *ctx);
+    void (*wait)(void *ctx);        // called locked: sleep until an event (__WFI)
+    uint32_t (*millis)(void *ctx);  // free-running millisecond tick
+    void *ctx;
+} row_port_t;
+
+typedef struct {
+    const row_port_t *port;
+    uint16_t width;
+    uint8_t *rx_rows;
+    uint8_t *tx_rows;
+    // Ring positions count rows since start; slot = position % ring size
+    volatile uint32_t rx_head;      // rows received
+    volatile uint32_t rx_tail;      // rows read
+    volatile uint32_t tx_head;      // rows queued
+    volatile uint32_t tx_tail;      // rows sent
+    volatile uint8_t rx_running;    // between start() and stop()
+    volatile uint8_t rx_busy;       // a row receive is in progress
+    volatile uint8_t tx_busy;
+    volatile uint8_t rx_failed;     // a receive stopped on an error; read() fails until restart
+    // Statistics
+    volatile uint32_t rx_stalls;    // receive ring full: the line is not read until a row is freed
+    volatile uint32_t errors;
+} row_transport_t;
+
+// buffer: ROW_TRANSPORT_BUFFER_SIZE(width) bytes
+void row_transport_init(row_transport_t *t, const row_port_t *port, uint16_t width,
+                        uint8_t *buffer);
+
+// Empties the receive ring and starts receiving the first row
+void row_transport_start(row_transport_t *t);
+
+// Stops receiving; rows already queued for sending still go out
+void row_transport_stop(row_transport_t *t);
+
+/* Copies the oldest received row into row. Returns 0, or -1 if none
+ * arrived within timeout_ms or a receive error lost bytes since start. */
+int row_transport_read(row_transport_t *t, uint8_t *row, uint32_t timeout_ms);
+
+/* After a failed read(): discards input until no row has arrived for
+ * idle_ms, so that receiving starts again at the beginning of a row.
+ * idle_ms must be longer than one row takes on the line. */
+void row_transport_resync(row_transport_t *t, uint32_t idle_ms);
+
+// Queues a copy of row for sending; waits while the send ring is full
+void row_transport_write(row_transport_t *t, const uint8_t *row);
+
+/* Interrupt side: a row was received or sent, or an error stopped the
+ * directions in stopped (ROW_ERROR_*). A stopped send is started again
+ * from the beginning of its row. */
+void row_transport_rx_complete(row_transport_t *t);
+void row_transport_tx_complete(row_transport_t *t);
+void row_transport_error(row_transport_t *t, uint32_t stopped);
+
+#endif /* ROW_TRANSPORT_H_ */
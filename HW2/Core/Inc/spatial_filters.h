@@ -0,0 +1,156 @@
+/*
+ * spatial_filters.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef SPATIAL_FILTERS_H_
+#define SPATIAL_FILTERS_H_
+
+#include <stdint.h>
+#include "image_view.h"
+
+#define MEDIAN_MAX_KERNEL_SIZE 11
+#define MEDIAN_MAX_WINDOW (MEDIAN_MAX_KERNEL_SIZE * MEDIAN_MAX_KERNEL_SIZE)
+
+/*
+ * How taps outside the view are read:
+ *   REPLICATE  nearest pixel of the view             aaa|abcd|ddd
+ *   REFLECT    mirrored without repeating the edge   cb|abcd|cb
+ *   CONSTANT   border_t.value
+ *   PADDED     the view sits inside a larger buffer with at least
+ *              kernel_size / 2 ghost rows and columns around it, which are
+ *              read directly
+ */
+typedef enum {
+    BORDER_REPLICATE,
+    BORDER_REFLECT,
+    BORDER_CONSTANT,
+    BORDER_PADDED
+} border_mode_t;
+
+typedef struct {
+    border_mode_t mode;
+    float value;            // BORDER_CONSTANT only
+} border_t;
+
+/*
+ * Neighbourhood filters on views. src and dst have the same size and may
+ * have different strides, so a filter can read or write a region of a
+ * larger frame in place.
+ *
+ * Only the pixels within kernel_size / 2 of the view's edges apply the
+ * border mode; the interior reads its taps without any bounds checks. The
+ * _border functions take the mode, the plain ones replicate the border.
+ *
+ * Each filter exists once per pixel type; the unsuffixed names are the
+ * 8-bit versions. u16 results are clamped to PIXEL_U16_MAX (12-bit data),
+ * float results are neither rounded nor clamped. SPATIAL_FILTER() picks the
+ * version from the pixel type at compile time.
+ */
+void apply_2d_convolution(const image_view_t *src, const image_view_t *dst,
+                          const float *kernel, int kernel_size);
+void apply_2d_convolution_u16(const image_view_t *src, const image_view_t *dst,
+                              const float *kernel, int kernel_size);
+void apply_2d_convolution_f32(const image_view_t *src, const image_view_t *dst,
+                              const float *kernel, int kernel_size);
+void apply_2d_convolution_border(const image_view_t *src, const image_view_t *dst,
+                                 const float *kernel, int kernel_size, const border_t *border);
+void apply_2d_convolution_u16_border(const image_view_t *src, const image_view_t *dst,
+                                     const float *kernel, int kernel_size, const border_t *border);
+void apply_2d_convolution_f32_border(const image_view_t *src, const image_view_t *dst,
+                                     const float *kernel, int kernel_size, const border_t *border);
+
+void sort_window(uint8_t *window, int size);
+void sort_window_u16(uint16_t *window, int size);
+void sort_window_f32(float *window, int size);
+
+// kernel_size up to MEDIAN_MAX_KERNEL_SIZE
+void apply_median_filtering(const image_view_t *src, const image_view_t *dst,
+                            int kernel_size);
+void apply_median_filtering_u16(const image_view_t *src, const image_view_t *dst,
+                                int kernel_size);
+void apply_median_filtering_f32(const image_view_t *src, const image_view_t *dst,
+                                int kernel_size);
+void apply_median_filtering_border(const image_view_t *src, const image_view_t *dst,
+                                   int kernel_size, const border_t *border);
+void apply_median_filtering_u16_border(const image_view_t *src, const image_view_t *dst,
+                                       int kernel_size, const border_t *border);
+void apply_median_filtering_f32_border(const image_view_t *src, const image_view_t *dst,
+                                       int kernel_size, const border_t *border);
+
+/*
+ * Mean over a kernel_size x kernel_size box (odd size), rounded to nearest,
+ * at a constant cost per pixel for any size. col_sums holds src->width
+ * entries. For 3x3 the output is identical to apply_2d_convolution() with
+ * low_pass_kernel_3x3.
+ */
+void apply_box_filter(const image_view_t *src, const image_view_t *dst,
+                      int kernel_size, uint32_t *col_sums);
+
+/*
+ * Filter bank on one box sum: with S the kernel_size x kernel_size sum
+ * around a pixel and c the pixel itself, output n is
+ *     (center_weight * c + sum_weight * S) / divisor,
+ * rounded to nearest and clamped to 0..255. The sum is computed once per
+ * pixel like apply_box_filter() and shared by all outputs, so any mix of
+ * the filters below costs one neighbourhood pass. For 3x3 the low-pass and
+ * high-pass outputs are identical to apply_2d_convolution() with
+ * low_pass_kernel_3x3 and high_pass_kernel_3x3. count is at most
+ * BOX_BANK_MAX_OUTPUTS, and the weighted sums must fit in 32 bits.
+ */
+typedef struct {
+    int16_t center_weight;
+    int16_t sum_weight;
+    uint16_t divisor;
+} box_combination_t;
+
+#define BOX_BANK_MAX_OUTPUTS 4
+
+#define BOX_LOW_PASS_3X3   { 0, 1, 9 }     // S / 9
+#define BOX_HIGH_PASS_3X3  { 9, -1, 1 }    // 9c - S, the 8-neighbour Laplacian
+// c + amount * (c - S / 9), amount = num / den
+#define BOX_UNSHARP_3X3(num, den) \
+    { (int16_t)(9 * ((den) + (num))), (int16_t)(-(num)), (uint16_t)(9 * (den)) }
+
+void apply_box_filter_bank(const image_view_t *src, const image_view_t *const *dsts,
+                           const box_combination_t *combinations, int count,
+                           int kernel_size, uint32_t *col_sums);
+
+/*
+ * 8-bit median for any odd kernel_size up to 255, with a cost per pixel
+ * that does not grow with the kernel. Borders are replicated and the output
+ * is identical to apply_median_filtering(). workspace holds
+ * MEDIAN_CT_WORKSPACE_SIZE(src->width) bytes of column histograms.
+ */
+#define MEDIAN_CT_WORKSPACE_SIZE(width) ((uint32_t)(width) * (16 + 256))
+
+void apply_median_filtering_ct(const image_view_t *src, const image_view_t *dst,
+                               int kernel_size, uint8_t *workspace);
+
+/*
+ * 8-bit 3x3 median from sorted columns, 4 pixels per 32-bit operation
+ * (spatial_filters_simd.c). Output identical to apply_median_filtering()
+ * with kernel_size 3. line_buf holds MEDIAN3_LINE_BUFFER_SIZE(src->width)
+ * bytes.
+ */
+#define MEDIAN3_LINE_BUFFER_SIZE(width) (3 * ((uint32_t)(width) + 2))
+
+void apply_median3(const image_view_t *src, const image_view_t *dst, uint8_t *line_buf);
+
+// One output row of apply_median3() from the rows above, at and below it
+void median3_row(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2,
+                 uint8_t *out, int width, uint8_t *line_buf);
+
+/*
+ * SPATIAL_FILTER(apply_2d_convolution, pixels, &src, &dst, kernel, 3) calls
+ * the version matching the element type of `pixels`, the buffer behind the
+ * views.
+ */
+#define SPATIAL_FILTER(name, pixels, ...) _Generic((pixels), \
+    uint8_t *: name, const uint8_t *: name, \
+    uint16_t *: name##_u16, const uint16_t *: name##_u16, \
+    float *: name##_f32, const float *: name##_f32)(__VA_ARGS__)
+
+#endif /* SPATIAL_FILTERS_H_ */
@@ -0,0 +1,71 @@
+/*
+ * stream_pipeline.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef STREAM_PIPELINE_H_
+#define STREAM_PIPELINE_H_
+
+#include <stdint.h>
+#include "spatial_filters.h"
+
+/*
+ * Row-streaming version of the HW2 chain: equalize -> {low-pass, high-pass,
+ * median}. Source rows are pulled one at a time, equalized into a 3-row
+ * ring buffer, and every output row is handed to the sink as soon as the
+ * rows it depends on have arrived: the equalized row at once, the 3x3
+ * results one row later. No frame buffer exists, so the height is only
+ * limited by the source, e.g. rows arriving over UART.
+ *
+ * The results are byte-identical to equalize_apply(), apply_2d_convolution()
+ * and apply_median_filtering() on the full frame (replicated borders).
+ *
+ * Equalization needs a histogram before the first row is mapped. Pass the
+ * LUT built from an earlier histogram pass over a replayable source, or,
+ * when every row is only seen once, the LUT of the previous frame; the
+ * histogram of the current frame is collected for the next one. An
+ * equalize_temporal_t provides both: pass its lut and histogram and call
+ * equalize_temporal_end_frame() after each run.
+ */
+typedef enum {
+    STREAM_EQUALIZED = 1 << 0,
+    STREAM_LOW_PASS  = 1 << 1,
+    STREAM_HIGH_PASS = 1 << 2,
+    STREAM_MEDIAN    = 1 << 3
+} stream_output_t;
+
+// Fills row with source row y; returns 0, or -1 if the row is not available
+typedef int (*stream_source_t)(void *ctx, uint32_t y, uint8_t *row, uint16_t width);
+// Receives final output row y; row is only valid during the call
+typedef void (*stream_sink_t)(void *ctx, stream_output_t output, uint32_t y,
+                              const uint8_t *row, uint16_t width);
+
+typedef struct {
+    uint16_t width;
+    uint32_t height;
+    stream_source_t source;
+    void *source_ctx;
+    stream_sink_t sink;
+    void *sink_ctx;
+    uint32_t outputs;              // stream_output_t flags
+    const uint8_t *eq_lut;         // NULL for identity
+    const float *low_pass_kernel;  // 3x3, STREAM_LOW_PASS only
+    const float *high_pass_kernel; // 3x3, STREAM_HIGH_PASS only
+    uint32_t *histogram;           // if not NULL, 256 bins of the source are added here
+} stream_pipeline_t;
+
+#define STREAM_KERNEL_SIZE 3
+
+// Ring buffer, output row and the median line buffer: 7 * width + 6 bytes
+#define STREAM_PIPELINE_BUFFER_SIZE(width) \
+    ((STREAM_KERNEL_SIZE + 1) * (uint32_t)(width) + MEDIAN3_LINE_BUFFER_SIZE(width))
+
+/*
+ * buffer holds STREAM_PIPELINE_BUFFER_SIZE(p->width) bytes. Returns 0, or
+ * -1 if the source failed; rows emitted before the failure stay valid.
+ */
+int stream_pipeline_run(const stream_pipeline_t *p, uint8_t *buffer);
+
+#endif /* STREAM_PIPELINE_H_ */
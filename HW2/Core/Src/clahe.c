@@ -0,0 +1,148 @@
+/*
+ * clahe.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include "clahe.h"
+#include "histogram.h"
+
+static inline uint32_t tile_edge(uint32_t i, uint32_t size, uint32_t tiles)
+{
+    return i * size / tiles;
+}
+
+/*
+ * Tile t covers [edge(t), edge(t + 1)) and its centre, in half pixels, is
+ * edge(t) + edge(t + 1) - 1. For position p (also in half pixels, 2p) this
+ * finds the tile whose centre is at or before it and the 8-bit weight of
+ * the next one. Before the first and after the last centre the weight is 0.
+ */
+static void blend_position(uint32_t p, uint32_t size, uint32_t tiles, uint8_t *tile, uint8_t *weight)
+{
+    uint32_t p2 = 2 * p;
+    uint32_t t = 0;
+
+    while (t + 1 < tiles &&
+           tile_edge(t + 1, size, tiles) + tile_edge(t + 2, size, tiles) - 1 <= p2) {
+        t++;
+    }
+    uint32_t c0 = tile_edge(t, size, tiles) + tile_edge(t + 1, size, tiles) - 1;
+
+    *tile = (uint8_t)t;
+    *weight = 0;
+    if (t + 1 < tiles && p2 > c0) {
+        uint32_t c1 = tile_edge(t + 1, size, tiles) + tile_edge(t + 2, size, tiles) - 1;
+        *weight = (uint8_t)(((p2 - c0) << 8) / (c1 - c0));
+    }
+}
+
+int clahe_init(clahe_t *c, uint16_t width, uint16_t height, uint8_t tiles_x, uint8_t tiles_y,
+               uint16_t clip_limit_q8, uint8_t *workspace)
+{
+    if (tiles_x == 0 || tiles_y == 0 || tiles_x > CLAHE_MAX_TILES || tiles_y > CLAHE_MAX_TILES ||
+        tiles_x > width || tiles_y > height) {
+        return -1;
+    }
+    c->width = width;
+    c->height = height;
+    c->tiles_x = tiles_x;
+    c->tiles_y = tiles_y;
+    c->clip_limit_q8 = clip_limit_q8;
+    c->luts = workspace;
+    c->col_tile = workspace + (uint32_t)tiles_x * tiles_y * CLAHE_LEVELS;
+    c->col_weight = c->col_tile + width;
+
+    for (uint32_t x = 0; x < width; x++) {
+        blend_position(x, width, tiles_x, &c->col_tile[x], &c->col_weight[x]);
+    }
+    return 0;
+}
+
+/*
+ * Clips the histogram of a tile of n pixels and spreads the excess: every
+ * bin gets excess / 256, and the remainder goes one count each to bins
+ * spaced evenly over the range. The table is then the cumulative histogram
+ * scaled to 0..255, rounded to nearest.
+ */
+static void tile_lut(uint32_t *hist, uint32_t n, uint16_t clip_limit_q8, uint8_t *lut)
+{
+    if (clip_limit_q8) {
+        uint32_t limit = (uint32_t)(((uint64_t)clip_limit_q8 * n) >> 16);
+        uint32_t excess = 0;
+
+        if (limit < 1) limit = 1;
+        for (int i = 0; i < CLAHE_LEVELS; i++) {
+            if (hist[i] > limit) {
+                excess += hist[i] - limit;
+                hist[i] = limit;
+            }
+        }
+        uint32_t batch = excess / CLAHE_LEVELS;
+        uint32_t residual = excess % CLAHE_LEVELS;
+        for (int i = 0; i < CLAHE_LEVELS; i++) hist[i] += batch;
+        if (residual) {
+            uint32_t step = CLAHE_LEVELS / residual;
+            for (uint32_t i = 0; i < CLAHE_LEVELS && residual; i += step, residual--) hist[i]++;
+        }
+    }
+
+    uint32_t cdf = 0;
+    for (int i = 0; i < CLAHE_LEVELS; i++) {
+        cdf += hist[i];
+        lut[i] = (uint8_t)((cdf * 255u + n / 2) / n);
+    }
+}
+
+void clahe_build(clahe_t *c, const image_view_t *src, uint32_t *hist_sub)
+{
+    uint32_t *hist = c->hist;
+
+    for (uint32_t ty = 0; ty < c->tiles_y; ty++) {
+        uint32_t y0 = tile_edge(ty, c->height, c->tiles_y);
+        uint32_t y1 = tile_edge(ty + 1, c->height, c->tiles_y);
+
+        for (uint32_t tx = 0; tx < c->tiles_x; tx++) {
+            uint32_t x0 = tile_edge(tx, c->width, c->tiles_x);
+            uint32_t x1 = tile_edge(tx + 1, c->width, c->tiles_x);
+            image_view_t tile = image_view_roi(src, (uint16_t)x0, (uint16_t)y0,
+                                               (uint16_t)(x1 - x0), (uint16_t)(y1 - y0));
+
+            histogram_u8(&tile, hist, hist_sub);
+            tile_lut(hist, (x1 - x0) * (y1 - y0), c->clip_limit_q8,
+                     &c->luts[(ty * c->tiles_x + tx) * CLAHE_LEVELS]);
+        }
+    }
+}
+
+void clahe_map_row(const clahe_t *c, uint32_t y, const uint8_t *src, uint8_t *dst)
+{
+    uint8_t ty, wy;
+    uint32_t last_x = c->tiles_x - 1u;
+
+    blend_position(y, c->height, c->tiles_y, &ty, &wy);
+    const uint8_t *top = &c->luts[(uint32_t)ty * c->tiles_x * CLAHE_LEVELS];
+    const uint8_t *bottom = (wy) ? top + c->tiles_x * CLAHE_LEVELS : top;
+
+    for (uint32_t x = 0; x < c->width; x++) {
+        uint32_t t = c->col_tile[x];
+        uint32_t p = src[x];
+        int32_t wx = c->col_weight[x];
+        uint32_t left = t * CLAHE_LEVELS + p;
+        uint32_t right = ((t < last_x) ? t + 1 : t) * CLAHE_LEVELS + p;
+
+        // Both rows blended horizontally in Q8, then vertically in Q16
+        int32_t a = (int32_t)top[left] * 256 + ((int32_t)top[right] - top[left]) * wx;
+        int32_t b = (int32_t)bottom[left] * 256 + ((int32_t)bottom[right] - bottom[left]) * wx;
+        dst[x] = (uint8_t)((a * 256 + (b - a) * (int32_t)wy + 32768) >> 16);
+    }
+}
+
+void clahe_apply(clahe_t *c, const image_view_t *src, const image_view_t *dst, uint32_t *hist_sub)
+{
+    clahe_build(c, src, hist_sub);
+    for (uint32_t y = 0; y < c->height; y++) {
+        clahe_map_row(c, y, IMAGE_VIEW_ROW_U8(src, y), IMAGE_VIEW_ROW_U8(dst, y));
+    }
+}
@@ -0,0 +1,179 @@
+/*
+ * conv_plan.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <math.h>
+#include <string.h>
+#include "conv_plan.h"
+#include "pixel_math.h"
+#include "spatial_filters.h"
+
+/*
+ * A rank-1 kernel is col[j] * row[i]. Taking the largest entry as pivot,
+ * col is the pivot's column and row its row divided by the pivot; the
+ * kernel is separable if every entry matches the product to float
+ * precision.
+ */
+int conv_kernel_separable(const float *kernel, int size, float *row, float *col)
+{
+    int pr = 0, pc = 0;
+    float max = 0.0f;
+
+    for (int j = 0; j < size; j++) {
+        for (int i = 0; i < size; i++) {
+            float a = fabsf(kernel[j * size + i]);
+            if (a > max) { max = a; pr = j; pc = i; }
+        }
+    }
+    if (max == 0.0f) return 0;
+
+    float pivot = kernel[pr * size + pc];
+    for (int j = 0; j < size; j++) col[j] = kernel[j * size + pc];
+    for (int i = 0; i < size; i++) row[i] = kernel[pr * size + i] / pivot;
+
+    for (int j = 0; j < size; j++) {
+        for (int i = 0; i < size; i++) {
+            if (fabsf(kernel[j * size + i] - col[j] * row[i]) > 1e-5f * max) return 0;
+        }
+    }
+    return 1;
+}
+
+static uint32_t fft_size_for(uint16_t width, int size)
+{
+    uint32_t n = REAL_FFT_MIN_SIZE;
+    while (n < (uint32_t)width + size - 1) n <<= 1;
+    return n;
+}
+
+int conv_plan_init(conv_plan_t *p, const float *kernel, int size, uint16_t width,
+                   conv_strategy_t strategy, float *workspace)
+{
+    int separable = (size <= CONV_PLAN_MAX_KERNEL) &&
+                    conv_kernel_separable(kernel, size, p->row, p->col);
+
+    p->kernel = kernel;
+    p->size = size;
+    p->width = width;
+    p->fft_size = 0;
+
+    int forced = strategy != CONV_AUTO;
+    if (!forced) {
+        if (separable && size >= CONV_SEPARABLE_MIN_KERNEL) strategy = CONV_SEPARABLE;
+        else if (size >= CONV_FFT_MIN_KERNEL) strategy = CONV_FFT;
+        else strategy = CONV_DIRECT;
+    }
+
+    if (strategy == CONV_SEPARABLE) {
+        if (!separable) return -1;
+        p->ring = workspace;
+    } else if (strategy == CONV_FFT) {
+        uint32_t n = fft_size_for(width, size);
+        float *twiddles = workspace;
+
+        if (size > CONV_PLAN_MAX_KERNEL || real_fft_init(&p->fft, n, twiddles) != 0) {
+            if (forced) return -1;
+            strategy = CONV_DIRECT;     // row too long for the FFT, e.g. CMSIS above 4096
+        } else {
+            p->fft_size = n;
+            p->spectra = twiddles + REAL_FFT_TWIDDLE_FLOATS(n);
+            p->ring = p->spectra + size * n;
+            p->scratch = p->ring + size * n;
+
+            /*
+             * apply_2d_convolution() correlates, in[x + i - c] * k[i], so each
+             * kernel row is reversed to turn it into a convolution.
+             */
+            for (int j = 0; j < size; j++) {
+                float *buf = p->scratch;
+                memset(buf, 0, n * sizeof(float));
+                for (int i = 0; i < size; i++) buf[i] = kernel[j * size + size - 1 - i];
+                real_fft_forward(&p->fft, buf, &p->spectra[j * n]);
+            }
+        }
+    }
+    p->strategy = strategy;
+    return strategy;
+}
+
+// Horizontal pass of source row y into its ring slot
+static void separable_row(const conv_plan_t *p, const image_view_t *src, int y)
+{
+    const uint8_t *in = IMAGE_VIEW_ROW_U8(src, y);
+    float *out = &p->ring[(y % p->size) * p->width];
+    int width = p->width;
+    int c = p->size / 2;
+
+    for (int x = 0; x < width; x++) {
+        float sum = 0.0f;
+        for (int i = 0; i < p->size; i++) sum += (float)in[clamp_index(x + i - c, width)] * p->row[i];
+        out[x] = sum;
+    }
+}
+
+/*
+ * Spectrum of source row y, replicated by c pixels on both sides and zero
+ * padded to the FFT size, which is at least width + size - 1 so the
+ * circular convolution does not wrap into the pixels that are kept.
+ */
+static void fft_row(const conv_plan_t *p, const image_view_t *src, int y)
+{
+    const uint8_t *in = IMAGE_VIEW_ROW_U8(src, y);
+    float *buf = p->scratch;
+    int width = p->width;
+    int c = p->size / 2;
+    uint32_t t = 0;
+
+    for (; t < (uint32_t)width + p->size - 1; t++) buf[t] = (float)in[clamp_index((int)t - c, width)];
+    for (; t < p->fft_size; t++) buf[t] = 0.0f;
+    real_fft_forward(&p->fft, buf, &p->ring[(y % p->size) * p->fft_size]);
+}
+
+void conv_plan_apply(const conv_plan_t *p, const image_view_t *src, const image_view_t *dst)
+{
+    if (p->strategy == CONV_DIRECT) {
+        apply_2d_convolution(src, dst, p->kernel, p->size);
+        return;
+    }
+
+    int height = src->height;
+    int width = p->width;
+    int c = p->size / 2;
+    int next_row = 0;   // next source row to bring into the ring
+
+    for (int y = 0; y < height; y++) {
+        int last = clamp_index(y + c, height);
+        while (next_row <= last) {
+            if (p->strategy == CONV_SEPARABLE) separable_row(p, src, next_row);
+            else fft_row(p, src, next_row);
+            next_row++;
+        }
+        uint8_t *out = IMAGE_VIEW_ROW_U8(dst, y);
+
+        if (p->strategy == CONV_SEPARABLE) {
+            for (int x = 0; x < width; x++) {
+                float sum = 0.0f;
+                for (int j = 0; j < p->size; j++) {
+                    sum += p->ring[(clamp_index(y + j - c, height) % p->size) * width + x] * p->col[j];
+                }
+                out[x] = store_u8(sum);
+            }
+        } else {
+            uint32_t n = p->fft_size;
+            float *acc = p->scratch;
+            float *row = p->scratch + n;
+
+            memset(acc, 0, n * sizeof(float));
+            for (int j = 0; j < p->size; j++) {
+                real_fft_multiply_add(&p->ring[(clamp_index(y + j - c, height) % p->size) * n],
+                                      &p->spectra[j * n], acc, n);
+            }
+            real_fft_inverse(&p->fft, acc, row);
+            // Output x is linear convolution sample x + size - 1
+            for (int x = 0; x < width; x++) out[x] = store_u8(row[x + p->size - 1]);
+        }
+    }
+}
@@ -0,0 +1,110 @@
+/*
+ * conv_q15.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "conv_q15.h"
+#include "pixel_math.h"
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#define smlad(a, b, acc) __smlad((a), (b), (acc))
+#else
+// Portable SMLAD: acc + a.lo * b.lo + a.hi * b.hi on signed halfwords
+static inline int32_t smlad(uint32_t a, uint32_t b, int32_t acc)
+{
+    return acc + (int16_t)a * (int16_t)b + (int16_t)(a >> 16) * (int16_t)(b >> 16);
+}
+#endif
+
+int conv_q15_init(conv_q15_t *q, const float *kernel, int kernel_size)
+{
+    if (kernel_size < 1 || kernel_size > CONV_Q15_MAX_SIZE || !(kernel_size & 1)) return -1;
+
+    float max_abs = 0.0f;
+    for (int i = 0; i < kernel_size * kernel_size; i++) {
+        float a = kernel[i] < 0.0f ? -kernel[i] : kernel[i];
+        if (a > max_abs) max_abs = a;
+    }
+
+    // Most fractional bits for which every coefficient still fits in int16_t
+    int frac_bits = 15;
+    while (frac_bits > 0 && max_abs * (float)(1 << frac_bits) > 32767.0f) frac_bits--;
+
+    memset(q, 0, sizeof(*q));
+    q->size = (uint8_t)kernel_size;
+    q->frac_bits = (uint8_t)frac_bits;
+
+    for (int j = 0; j < kernel_size; j++) {
+        int16_t row[CONV_Q15_PAIRS * 2] = {0};
+        for (int i = 0; i < kernel_size; i++) {
+            float v = kernel[j * kernel_size + i] * (float)(1 << frac_bits);
+            row[i] = (int16_t)(v < 0.0f ? v - 0.5f : v + 0.5f);
+        }
+        for (int p = 0; p < CONV_Q15_PAIRS; p++) {
+            q->pairs[j][p] = (uint16_t)row[2 * p] | ((uint32_t)(uint16_t)row[2 * p + 1] << 16);
+        }
+    }
+    return 0;
+}
+
+/*
+ * Source row y widened to int16_t with the border already replicated, so
+ * entry x + i of the row is the tap i pixel of output x. The extra last
+ * entry pairs with the zero padding tap of odd-sized kernels.
+ */
+static void load_row(const image_view_t *src, int y, int r, int16_t *row)
+{
+    const uint8_t *in = IMAGE_VIEW_ROW_U8(src, y);
+    int width = src->width;
+
+    for (int x = -r; x < width + r + 1; x++) row[x + r] = in[clamp_index(x, width)];
+}
+
+void apply_2d_convolution_q15(const conv_q15_t *q, const image_view_t *src,
+                              const image_view_t *dst, int16_t *rows)
+{
+    int k = q->size;
+    int r = k / 2;
+    int pairs = (k + 1) / 2;
+    int height = src->height;
+    int width = src->width;
+    int row_len = width + k + 1;
+    int32_t round = (q->frac_bits > 0) ? (1 << (q->frac_bits - 1)) : 0;
+    int next_row = 0;   // next source row to widen into the ring of k rows
+
+    for (int y = 0; y < height; y++) {
+        int last = clamp_index(y + r, height);
+        while (next_row <= last) {
+            load_row(src, next_row, r, &rows[(next_row % k) * row_len]);
+            next_row++;
+        }
+
+        const int16_t *taps[CONV_Q15_MAX_SIZE];
+        for (int j = 0; j < k; j++) {
+            taps[j] = &rows[(clamp_index(y + j - r, height) % k) * row_len];
+        }
+        uint8_t *out = IMAGE_VIEW_ROW_U8(dst, y);
+
+        for (int x = 0; x < width; x++) {
+            int32_t acc = round;
+
+            for (int j = 0; j < k; j++) {
+                const int16_t *px = &taps[j][x];
+                for (int p = 0; p < pairs; p++) {
+                    uint32_t two;
+                    memcpy(&two, &px[2 * p], 4);
+                    acc = smlad(two, q->pairs[j][p], acc);
+                }
+            }
+
+            int32_t result = acc >> q->frac_bits;
+            if (result < 0) result = 0;
+            if (result > 255) result = 255;
+            out[x] = (uint8_t)result;
+        }
+    }
+}
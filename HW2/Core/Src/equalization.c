@@ -0,0 +1,158 @@
+/*
+ * equalization.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "equalization.h"
+
+/*
+ * round(255 * a / d) == (2 * 255 * a + d) / (2 * d) in integers, with
+ * a <= d. The numerator fits in 32 bits up to d = UINT32_MAX / 511, about
+ * 8.4M pixels (4096x2048 still fits); larger images take a 64-bit division.
+ */
+#define EQUALIZE_MAX_32BIT (UINT32_MAX / 511u)
+
+void equalize_lut(const uint32_t *histogram, uint32_t total, uint8_t *lut)
+{
+    int first = 0;
+    while (first < EQUALIZE_LEVELS && histogram[first] == 0) first++;
+    if (first == EQUALIZE_LEVELS) {
+        memset(lut, 0, EQUALIZE_LEVELS);
+        return;
+    }
+
+    uint32_t cdf_min = histogram[first];
+    uint32_t den = total - cdf_min;
+    uint32_t cdf = 0;
+
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        cdf += histogram[r];
+        if (cdf <= cdf_min || den == 0) {
+            lut[r] = 0;
+        } else if (den <= EQUALIZE_MAX_32BIT) {
+            lut[r] = (uint8_t)((2u * 255u * (cdf - cdf_min) + den) / (2u * den));
+        } else {
+            lut[r] = (uint8_t)((2ull * 255u * (cdf - cdf_min) + den) / (2ull * den));
+        }
+    }
+}
+
+void equalize_apply(const uint8_t *lut, const image_view_t *src, const image_view_t *dst)
+{
+    for (int y = 0; y < src->height; y++) {
+        const uint8_t *in = IMAGE_VIEW_ROW_U8(src, y);
+        uint8_t *out = IMAGE_VIEW_ROW_U8(dst, y);
+        int x = 0;
+
+        // 4 pixels per iteration to hide the load-use latency of the table reads
+        for (; x + 4 <= src->width; x += 4) {
+            uint8_t p0 = in[x];
+            uint8_t p1 = in[x + 1];
+            uint8_t p2 = in[x + 2];
+            uint8_t p3 = in[x + 3];
+            out[x]     = lut[p0];
+            out[x + 1] = lut[p1];
+            out[x + 2] = lut[p2];
+            out[x + 3] = lut[p3];
+        }
+        for (; x < src->width; x++) out[x] = lut[in[x]];
+    }
+}
+
+void equalize_temporal_init(equalize_temporal_t *t, uint16_t new_weight_q8)
+{
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        t->lut[r] = (uint8_t)r;
+        t->smoothed[r] = (uint16_t)(r << 8);
+    }
+    memset(t->histogram, 0, sizeof(t->histogram));
+    t->new_weight_q8 = (new_weight_q8 > 256) ? 256 : new_weight_q8;
+    t->frames = 0;
+}
+
+void equalize_temporal_row(equalize_temporal_t *t, const uint8_t *src, uint8_t *dst, uint32_t width)
+{
+    const uint8_t *lut = t->lut;
+    uint32_t *hist = t->histogram;
+    uint32_t x = 0;
+
+    // Each pixel is loaded once for both the lookup and the count
+    for (; x + 4 <= width; x += 4) {
+        uint8_t p0 = src[x];
+        uint8_t p1 = src[x + 1];
+        uint8_t p2 = src[x + 2];
+        uint8_t p3 = src[x + 3];
+        dst[x]     = lut[p0];
+        dst[x + 1] = lut[p1];
+        dst[x + 2] = lut[p2];
+        dst[x + 3] = lut[p3];
+        hist[p0]++;
+        hist[p1]++;
+        hist[p2]++;
+        hist[p3]++;
+    }
+    for (; x < width; x++) {
+        uint8_t p = src[x];
+        dst[x] = lut[p];
+        hist[p]++;
+    }
+}
+
+void equalize_temporal_end_frame(equalize_temporal_t *t)
+{
+    uint8_t next[EQUALIZE_LEVELS];
+    uint32_t total = 0;
+
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) total += t->histogram[r];
+    equalize_lut(t->histogram, total, next);
+
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        int32_t target = (int32_t)next[r] << 8;
+
+        // The first table is taken as it is; smoothing towards identity would only delay it
+        if (t->frames == 0) {
+            t->smoothed[r] = (uint16_t)target;
+        } else {
+            int32_t s = t->smoothed[r];
+            t->smoothed[r] = (uint16_t)(s + (target - s) * t->new_weight_q8 / 256);
+        }
+        t->lut[r] = (uint8_t)((t->smoothed[r] + 128) >> 8);
+    }
+    memset(t->histogram, 0, sizeof(t->histogram));
+    t->frames++;
+}
+
+void equalize_lut_float(const uint32_t *histogram, uint32_t total, uint8_t *lut)
+{
+    float cdf[EQUALIZE_LEVELS];
+
+    cdf[0] = (float)histogram[0] / total;
+    for (int i = 1; i < EQUALIZE_LEVELS; i++) {
+        cdf[i] = cdf[i-1] + ((float)histogram[i] / (float)total);
+    }
+
+    int i = 0;
+    while (i < EQUALIZE_LEVELS && cdf[i] <= 0.0f) {
+        i++;
+    }
+    float cdf_min = (i < EQUALIZE_LEVELS) ? cdf[i] : 0.0f;
+    float normalization_factor = 1.0f / (1.0f - cdf_min);
+
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        float s_k_float;
+
+        if (cdf[r] == cdf_min) {
+            s_k_float = 0.0f;
+        } else {
+            s_k_float = (cdf[r] - cdf_min) * normalization_factor * 255.0f;
+        }
+
+        int result = (int)(s_k_float + 0.5f);
+        if (result > 255) result = 255;
+        if (result < 0) result = 0;
+        lut[r] = (uint8_t)result;
+    }
+}
@@ -0,0 +1,71 @@
+/*
+ * filter_graph.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stddef.h>
+#include "filter_graph.h"
+
+// Returns the stage that writes `b`, or NULL for a source buffer
+static filter_stage_t *producer_of(const filter_graph_t *g, const graph_buffer_t *b)
+{
+    for (uint32_t s = 0; s < g->count; s++) {
+        const filter_stage_t *st = &g->stages[s];
+        for (uint8_t k = 0; k < st->num_outputs; k++) {
+            if (st->outputs[k] == b) return &g->stages[s];
+        }
+    }
+    return NULL;
+}
+
+static int is_dirty(const filter_stage_t *st)
+{
+    if (!st->has_run) return 1;
+    for (uint8_t k = 0; k < st->num_inputs; k++) {
+        if (st->inputs[k]->version != st->seen[k]) return 1;
+    }
+    return 0;
+}
+
+int filter_graph_run(filter_graph_t *g)
+{
+    uint32_t done = 0;          // bit s set once stage s has been visited
+    uint32_t visited = 0;
+
+    if (g->count > GRAPH_MAX_STAGES) return -1;
+
+    // Visit a stage once all of its producers are visited; the graphs here
+    // are a handful of stages, so the quadratic scan is cheaper than a sort
+    while (visited < g->count) {
+        uint32_t progress = 0;
+
+        for (uint32_t s = 0; s < g->count; s++) {
+            filter_stage_t *st = &g->stages[s];
+            if (done & (1u << s)) continue;
+
+            uint8_t ready = 1;
+            for (uint8_t k = 0; k < st->num_inputs; k++) {
+                filter_stage_t *p = producer_of(g, st->inputs[k]);
+                if (p && !(done & (1u << (uint32_t)(p - g->stages)))) ready = 0;
+            }
+            if (!ready) continue;
+
+            if (is_dirty(st)) {
+                st->run(st->ctx);
+                for (uint8_t k = 0; k < st->num_inputs; k++) st->seen[k] = st->inputs[k]->version;
+                st->has_run = 1;
+                for (uint8_t k = 0; k < st->num_outputs; k++) graph_buffer_touch(st->outputs[k]);
+                g->executed++;
+            } else {
+                g->skipped++;
+            }
+            done |= 1u << s;
+            visited++;
+            progress++;
+        }
+        if (!progress) return -1;
+    }
+    return 0;
+}
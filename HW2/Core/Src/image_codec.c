@@ -0,0 +1,146 @@
+/*
+ * image_codec.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "image_codec.h"
+
+#define LZ4_MIN_MATCH 4
+#define WINDOW_MASK   (IMAGE_CODEC_WINDOW - 1)
+
+void image_decoder_init(image_decoder_t *dec, const compressed_image_t *img)
+{
+	memset(dec, 0, sizeof(*dec));
+	dec->img = img;
+}
+
+// LZ4 length: 15 in the token means more bytes follow until one is < 255
+static uint32_t lz4_length(image_decoder_t *dec, uint32_t nibble)
+{
+	uint32_t n = nibble;
+	if(nibble == 15){
+		uint8_t b;
+		do{
+			if(dec->in_pos >= dec->img->size) break;
+			b = dec->img->data[dec->in_pos++];
+			n += b;
+		}while(b == 255);
+	}
+	return n;
+}
+
+static uint32_t decode_rle(image_decoder_t *dec, uint8_t *dst, uint32_t len)
+{
+	const compressed_image_t *img = dec->img;
+	uint32_t produced = 0;
+
+	while(produced < len){
+		if(dec->run_left){
+			uint32_t n = len - produced;
+			if(n > dec->run_left) n = dec->run_left;
+			memset(&dst[produced], dec->run_value, n);
+			dec->run_left -= n;
+			produced += n;
+		}
+		else if(dec->lit_left){
+			uint32_t n = len - produced;
+			if(n > dec->lit_left) n = dec->lit_left;
+			if(n > img->size - dec->in_pos) n = img->size - dec->in_pos;
+			if(n == 0) break;
+			memcpy(&dst[produced], &img->data[dec->in_pos], n);
+			dec->in_pos += n;
+			dec->lit_left -= n;
+			produced += n;
+		}
+		else{
+			if(dec->in_pos >= img->size) break;
+			uint8_t c = img->data[dec->in_pos++];
+			if(c < 128){
+				dec->lit_left = c + 1u;
+			}
+			else{
+				if(dec->in_pos >= img->size) break;
+				dec->run_left = c - 126u;
+				dec->run_value = img->data[dec->in_pos++];
+			}
+		}
+	}
+	return produced;
+}
+
+static uint32_t decode_lz4(image_decoder_t *dec, uint8_t *dst, uint32_t len)
+{
+	const compressed_image_t *img = dec->img;
+	uint32_t produced = 0;
+
+	while(produced < len){
+		if(dec->lit_left){
+			if(dec->in_pos >= img->size) break;
+			uint8_t b = img->data[dec->in_pos++];
+			dec->window[dec->out_pos++ & WINDOW_MASK] = b;
+			dst[produced++] = b;
+			dec->lit_left--;
+		}
+		else if(dec->run_left){
+			// Byte by byte, so overlapping matches (offset < length) repeat correctly
+			uint8_t b = dec->window[(dec->out_pos - dec->offset) & WINDOW_MASK];
+			dec->window[dec->out_pos++ & WINDOW_MASK] = b;
+			dst[produced++] = b;
+			dec->run_left--;
+		}
+		else if(dec->match_pending){
+			// The last sequence has literals only and ends the block
+			if(dec->in_pos + 2 > img->size) break;
+			dec->offset = img->data[dec->in_pos] | (img->data[dec->in_pos + 1] << 8);
+			dec->in_pos += 2;
+			if(dec->offset == 0 || dec->offset > IMAGE_CODEC_WINDOW || dec->offset > dec->out_pos) break;
+			dec->run_left = lz4_length(dec, dec->match_len) + LZ4_MIN_MATCH;
+			dec->match_pending = 0;
+		}
+		else{
+			if(dec->in_pos >= img->size) break;
+			uint8_t token = img->data[dec->in_pos++];
+			dec->lit_left = lz4_length(dec, token >> 4);
+			dec->match_len = token & 0x0F;
+			dec->match_pending = 1;
+		}
+	}
+	return produced;
+}
+
+uint32_t image_decoder_read(image_decoder_t *dec, uint8_t *dst, uint32_t len)
+{
+	const compressed_image_t *img = dec->img;
+	const uint32_t total = (uint32_t)img->width * img->height;
+	uint32_t produced = 0;
+
+	if(len > total - dec->out_pos) len = total - dec->out_pos;
+
+	switch(img->codec){
+	case IMAGE_CODEC_RAW:
+		produced = len;
+		if(produced > img->size - dec->out_pos) produced = img->size - dec->out_pos;
+		memcpy(dst, &img->data[dec->out_pos], produced);
+		dec->out_pos += produced;
+		dec->in_pos = dec->out_pos;
+		break;
+	case IMAGE_CODEC_RLE:
+		produced = decode_rle(dec, dst, len);
+		dec->out_pos += produced;
+		break;
+	case IMAGE_CODEC_LZ4:
+		produced = decode_lz4(dec, dst, len);  // advances out_pos itself
+		break;
+	}
+	return produced;
+}
+
+int image_decoder_row_source(void *ctx, uint32_t y, uint8_t *row, uint16_t width)
+{
+	(void)y;
+	image_decoder_t *dec = ctx;
+	return (image_decoder_read(dec, row, width) == width) ? 0 : -1;
+}
@@ -22,18 +22,41 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <string.h>
 #include <image_to_process.h>
+#include "spatial_filters.h"
+#include "equalization.h"
+#include "pipeline.h"
+#include "stream_pipeline.h"
+#include "row_transport.h"
+#include "image_codec.h"
+#include "image_to_process_lz4.h"
+#include "filter_graph.h"
+#include "conv_q15.h"
+#include "conv_plan.h"
+#include "clahe.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
 #define NUM_GRAY_LEVELS 256
 #define MEDIAN_KERNEL_SIZE 3
-#define WINDOW_SIZE (MEDIAN_KERNEL_SIZE * MEDIAN_KERNEL_SIZE) // 9
+#define WINDOW_TAPS (MEDIAN_KERNEL_SIZE * MEDIAN_KERNEL_SIZE)
+#define CLAHE_TILES 4                 // 4x4 tiles of 16x16 pixels
+#define CLAHE_CLIP_LIMIT CLAHE_CLIP_Q8(2.0)
 /* USER CODE END PTD */
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+// 1: after the benchmarks, equalize and median-filter frames streamed over USART2
+#define STREAM_UART_FRAMES 0
+#define STREAM_UART_WIDTH 640
+#define STREAM_UART_HEIGHT 480
+#define STREAM_UART_TIMEOUT_MS 1000
+// Longer than one row on the line (640 bytes take 56 ms at 115200 baud)
+#define STREAM_UART_IDLE_MS 200
+// Weight of the newest frame's equalization table, out of 256
+#define TEMPORAL_NEW_WEIGHT_Q8 64
 
 /* USER CODE END PD */
 
@@ -45,7 +68,8 @@
 /* Private variables ---------------------------------------------------------*/
 UART_HandleTypeDef huart2;
 uint32_t histogram[NUM_GRAY_LEVELS];
-float cdf[NUM_GRAY_LEVELS];
+uint32_t histogram_sub[HISTOGRAM_SUB_WORDS];   // histogram_u8() workspace for this file
+uint8_t equalization_lut[NUM_GRAY_LEVELS];
 uint8_t equalized_image[IMAGE_SIZE];
 uint8_t output_image_med[IMAGE_SIZE] = {0};
 uint8_t output_image_hp[IMAGE_SIZE] = {0};
@@ -66,6 +90,122 @@ const float high_pass_kernel_3x3[9] = {
 
 
 /* USER CODE BEGIN PV */
+uint32_t equalized_histogram[NUM_GRAY_LEVELS];
+uint32_t box_col_sums[IMAGE_WIDTH];
+
+// Adaptive equalization of the original image, next to the global one
+uint8_t clahe_image[IMAGE_SIZE];
+uint8_t clahe_workspace[CLAHE_WORKSPACE_SIZE(IMAGE_WIDTH, CLAHE_TILES, CLAHE_TILES)];
+clahe_t clahe;
+volatile uint32_t bench_clahe_build_cycles;   // tile histograms and tables
+volatile uint32_t bench_clahe_map_cycles;     // bilinear blend of all rows
+
+// Reference and candidate outputs shared by the benchmarks below
+uint8_t bench_ref_out[IMAGE_SIZE];
+uint8_t bench_test_out[IMAGE_SIZE];
+
+// Box filter against the generic convolution for k = 3, 7, 15, 31
+#define NUM_BOX_SIZES 4
+#define MAX_BOX_SIZE 31
+static const int box_sizes[NUM_BOX_SIZES] = { 3, 7, 15, 31 };
+float box_kernel[MAX_BOX_SIZE * MAX_BOX_SIZE];
+volatile uint32_t bench_box_generic_cycles[NUM_BOX_SIZES];
+volatile uint32_t bench_box_running_cycles[NUM_BOX_SIZES];
+volatile uint32_t bench_box_mismatches[NUM_BOX_SIZES];
+
+// Q15 convolution against the float one: LP, HP, then 5x5 and 7x7 means
+#define NUM_Q15_KERNELS 4
+int16_t q15_rows[CONV_Q15_ROWS_SIZE(IMAGE_WIDTH, CONV_Q15_MAX_SIZE)];
+volatile uint32_t bench_q15_float_cycles[NUM_Q15_KERNELS];
+volatile uint32_t bench_q15_cycles[NUM_Q15_KERNELS];
+volatile uint32_t bench_q15_max_deviation[NUM_Q15_KERNELS];
+
+// Sorting median against the histogram median for k = 3, 7, 11
+#define NUM_MEDIAN_SIZES 3
+static const int median_sizes[NUM_MEDIAN_SIZES] = { 3, 7, 11 };
+uint8_t bench_noisy[IMAGE_SIZE];
+uint8_t median_workspace[MEDIAN_CT_WORKSPACE_SIZE(IMAGE_WIDTH)];
+uint8_t median3_line_buf[MEDIAN3_LINE_BUFFER_SIZE(IMAGE_WIDTH)];
+volatile uint32_t bench_median3_cycles;       // against bench_median_sort_cycles[0]
+volatile uint32_t bench_median3_mismatches;
+volatile uint32_t bench_median_sort_cycles[NUM_MEDIAN_SIZES];
+volatile uint32_t bench_median_ct_cycles[NUM_MEDIAN_SIZES];
+volatile uint32_t bench_median_mismatches[NUM_MEDIAN_SIZES];
+
+// Convolution strategies for k = 3 .. 15: a binomial (separable) kernel runs
+// direct and separable, a random one direct and FFT
+#define NUM_CONV_SIZES 6
+#define MAX_CONV_SIZE 15
+static const int conv_sizes[NUM_CONV_SIZES] = { 3, 5, 7, 9, 11, 15 };
+float conv_workspace[CONV_PLAN_WORKSPACE_FLOATS(IMAGE_WIDTH, MAX_CONV_SIZE)];
+conv_plan_t conv_plan;
+volatile uint32_t bench_conv_binomial_direct_cycles[NUM_CONV_SIZES];
+volatile uint32_t bench_conv_separable_cycles[NUM_CONV_SIZES];
+volatile uint32_t bench_conv_random_direct_cycles[NUM_CONV_SIZES];
+volatile uint32_t bench_conv_fft_cycles[NUM_CONV_SIZES];
+volatile int32_t bench_conv_auto_strategy[NUM_CONV_SIZES];   // for the random kernel
+volatile uint32_t bench_conv_max_deviation[NUM_CONV_SIZES];  // levels, both kernels
+
+volatile uint32_t bench_bank_separate_cycles;  // two float 3x3 convolutions
+volatile uint32_t bench_bank_fused_cycles;     // one box-sum pass for both
+volatile uint32_t bench_bank_mismatches;
+
+volatile uint32_t bench_equalize_float_cycles;
+volatile uint32_t bench_equalize_int_cycles;
+volatile uint32_t bench_equalize_mismatches;   // pixels, integer LUT vs float reference
+
+// Temporal equalization on frames of the image whose brightness flickers
+#define TEMPORAL_FRAMES 8
+#define TEMPORAL_FLICKER 12
+equalize_temporal_t temporal_eq;
+uint32_t temporal_histogram[NUM_GRAY_LEVELS];
+uint8_t temporal_lut[NUM_GRAY_LEVELS];
+volatile uint32_t bench_temporal_two_pass_cycles;   // per frame: histogram, table, then mapping
+volatile uint32_t bench_temporal_cycles;            // per frame: mapping and counting, then table
+volatile uint32_t bench_temporal_raw_step;          // largest table change between frames, unsmoothed
+volatile uint32_t bench_temporal_smoothed_step;     // same with TEMPORAL_NEW_WEIGHT_Q8
+
+// The HW2 chain streamed row by row, checked against the full-frame outputs
+uint8_t stream_buf[STREAM_PIPELINE_BUFFER_SIZE(IMAGE_WIDTH)];
+volatile uint32_t bench_stream_cycles;
+volatile uint32_t bench_stream_buffer_bytes;
+volatile uint32_t bench_stream_mismatches;
+
+// The same chain fed by the LZ4 decoder instead of the raw image
+image_decoder_t stream_decoder;
+volatile uint32_t bench_stream_lz4_cycles;
+volatile uint32_t bench_stream_lz4_compressed_bytes;
+volatile uint32_t bench_stream_lz4_mismatches;
+volatile int32_t bench_stream_lz4_status;           // stream_pipeline_run(), 0 if every row decoded
+
+#if STREAM_UART_FRAMES
+uint8_t stream_uart_buf[STREAM_PIPELINE_BUFFER_SIZE(STREAM_UART_WIDTH)];
+uint8_t stream_uart_rows[ROW_TRANSPORT_BUFFER_SIZE(STREAM_UART_WIDTH)];
+row_transport_t stream_uart_transport;
+equalize_temporal_t stream_uart_eq;
+volatile uint32_t stream_uart_frames;
+#endif
+
+volatile uint32_t bench_graph_cycles;        // first run, every stage executes
+volatile uint32_t bench_graph_rerun_cycles;  // second run, nothing changed
+volatile uint32_t bench_graph_executed;
+volatile uint32_t bench_graph_skipped;
+
+// median3(equalize(image)) > otsu, stage by stage and as a fused pipeline
+uint8_t pipeline_med[IMAGE_SIZE];
+uint8_t pipeline_unfused[IMAGE_SIZE];
+uint8_t pipeline_fused[IMAGE_SIZE];
+uint8_t pipeline_line_buf[PIPELINE_LINE_BUFFER_SIZE(IMAGE_WIDTH)];
+
+volatile uint32_t bench_unfused_cycles;
+volatile uint32_t bench_unfused_bytes_read;
+volatile uint32_t bench_unfused_bytes_written;
+volatile uint32_t bench_unfused_buffer_bytes;
+volatile uint32_t bench_fused_cycles;
+volatile uint32_t bench_fused_bytes_read;
+volatile uint32_t bench_fused_bytes_written;
+volatile uint32_t bench_fused_buffer_bytes;
+volatile uint32_t bench_pipeline_mismatches;
 
 /* USER CODE END PV */
 
@@ -79,165 +219,663 @@ static void MX_USART2_UART_Init(void);
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-void apply_2d_convolution(const uint8_t *input_image, uint8_t *output_image,
-                          int height, int width, const float *kernel, int kernel_size) {
-
-    int center = kernel_size / 2;
-    int k_size = kernel_size;
+static void cycle_counter_init(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
 
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            float sum = 0.0f;
+/*
+ * HW2 processing as a filter graph: each stage runs once, and again only
+ * when one of its inputs changes.
+ */
+static void stage_histogram(void *ctx)
+{
+	(void)ctx;
+	image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	histogram_u8(&src, histogram, histogram_sub);
+}
 
+static void stage_equalize(void *ctx)
+{
+	(void)ctx;
+	image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	image_view_t dst = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
 
-            for (int j = 0; j < k_size; j++) {
-                for (int i = 0; i < k_size; i++) {
+	// Integer mapping table from the histogram, then one lookup per pixel
+	equalize_lut(histogram, IMAGE_SIZE, equalization_lut);
+	equalize_apply(equalization_lut, &src, &dst);
+}
 
+static void stage_equalized_histogram(void *ctx)
+{
+	(void)ctx;
+	image_view_t eq_view = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	histogram_u8(&eq_view, equalized_histogram, histogram_sub);
+}
 
-                    int image_y = y + j - center;
-                    int image_x = x + i - center;
+static void stage_low_high_pass(void *ctx)
+{
+	(void)ctx;
+	image_view_t eq_view = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	image_view_t lp_view = image_view_make(output_image_lp, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	image_view_t hp_view = image_view_make(output_image_hp, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	const image_view_t *outputs[2] = { &lp_view, &hp_view };
+	static const box_combination_t filters[2] = { BOX_LOW_PASS_3X3, BOX_HIGH_PASS_3X3 };
+
+	// Both outputs from one box sum per pixel, same results as the 3x3 kernels
+	apply_box_filter_bank(&eq_view, outputs, filters, 2, 3, box_col_sums);
+}
 
+static void stage_median(void *ctx)
+{
+	(void)ctx;
+	image_view_t eq_view = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	image_view_t med_view = image_view_make(output_image_med, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	// Same output as apply_median_filtering() with MEDIAN_KERNEL_SIZE 3
+	apply_median3(&eq_view, &med_view, median3_line_buf);
+}
 
-                    if (image_y < 0) image_y = 0;
-                    if (image_y >= height) image_y = height - 1;
-                    if (image_x < 0) image_x = 0;
-                    if (image_x >= width) image_x = width - 1;
+static void stage_clahe(void *ctx)
+{
+	(void)ctx;
+	image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+	image_view_t dst = image_view_make(clahe_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
 
+	clahe_init(&clahe, IMAGE_WIDTH, IMAGE_HEIGHT, CLAHE_TILES, CLAHE_TILES, CLAHE_CLIP_LIMIT, clahe_workspace);
+	clahe_apply(&clahe, &src, &dst, histogram_sub);
+}
 
-                    int input_index = image_y * width + image_x;
-                    int kernel_index = j * k_size + i;
+static graph_buffer_t buf_image          = { (void *)image, 0 };
+static graph_buffer_t buf_histogram      = { histogram, 0 };
+static graph_buffer_t buf_equalized      = { equalized_image, 0 };
+static graph_buffer_t buf_eq_histogram   = { equalized_histogram, 0 };
+static graph_buffer_t buf_lp             = { output_image_lp, 0 };
+static graph_buffer_t buf_hp             = { output_image_hp, 0 };
+static graph_buffer_t buf_med            = { output_image_med, 0 };
+static graph_buffer_t buf_clahe          = { clahe_image, 0 };
+
+static filter_stage_t hw2_stages[] = {
+	{ .name = "histogram", .run = stage_histogram,
+	  .inputs = { &buf_image }, .num_inputs = 1, .outputs = { &buf_histogram }, .num_outputs = 1 },
+	{ .name = "equalize", .run = stage_equalize,
+	  .inputs = { &buf_image, &buf_histogram }, .num_inputs = 2, .outputs = { &buf_equalized }, .num_outputs = 1 },
+	{ .name = "equalized_histogram", .run = stage_equalized_histogram,
+	  .inputs = { &buf_equalized }, .num_inputs = 1, .outputs = { &buf_eq_histogram }, .num_outputs = 1 },
+	{ .name = "low_high_pass", .run = stage_low_high_pass,
+	  .inputs = { &buf_equalized }, .num_inputs = 1, .outputs = { &buf_lp, &buf_hp }, .num_outputs = 2 },
+	{ .name = "median", .run = stage_median,
+	  .inputs = { &buf_equalized }, .num_inputs = 1, .outputs = { &buf_med }, .num_outputs = 1 },
+	{ .name = "clahe", .run = stage_clahe,
+	  .inputs = { &buf_image }, .num_inputs = 1, .outputs = { &buf_clahe }, .num_outputs = 1 },
+};
 
+static filter_graph_t hw2_graph = { hw2_stages, sizeof(hw2_stages) / sizeof(hw2_stages[0]), 0, 0 };
 
-                    sum += (float)input_image[input_index] * kernel[kernel_index];
-                }
-            }
+/*
+ * Mean filters of growing size: apply_2d_convolution() with a uniform
+ * k x k kernel does k*k multiply-adds per pixel, apply_box_filter() a
+ * constant amount of integer work.
+ */
+static void benchmark_box_filter(void)
+{
+  image_view_t eq = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t generic = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t running = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
 
+  for (int n = 0; n < NUM_BOX_SIZES; n++) {
+    int k = box_sizes[n];
+    for (int i = 0; i < k * k; i++) box_kernel[i] = 1.0f / (float)(k * k);
 
-            int result = (int)(sum + 0.5f);
+    uint32_t start = DWT->CYCCNT;
+    apply_2d_convolution(&eq, &generic, box_kernel, k);
+    bench_box_generic_cycles[n] = DWT->CYCCNT - start;
 
-            if (result < 0) result = 0;
-            if (result > 255) result = 255;
+    start = DWT->CYCCNT;
+    apply_box_filter(&eq, &running, k, box_col_sums);
+    bench_box_running_cycles[n] = DWT->CYCCNT - start;
 
-            output_image[y * width + x] = (uint8_t)result;
-        }
+    bench_box_mismatches[n] = 0;
+    for (int j = 0; j < IMAGE_SIZE; j++) {
+      if (bench_ref_out[j] != bench_test_out[j]) bench_box_mismatches[n]++;
     }
+  }
 }
-void sort_window(uint8_t *window, int size) {
-    for (int i = 0; i < size - 1; i++) {
-        for (int j = 0; j < size - 1 - i; j++) {
-            if (window[j] > window[j + 1]) {
-                // Swap işlemi (yer değiştirme)
-                uint8_t temp = window[j];
-                window[j] = window[j + 1];
-                window[j + 1] = temp;
-            }
-        }
-    }
+
+/*
+ * Low-pass and high-pass of the equalized image: as two float convolutions
+ * with 18 multiply-adds per pixel, and as one filter bank pass over shared
+ * box sums. Both write to bench_ref_out and bench_test_out; the float
+ * results are checked against the graph's outputs, which the filter graph
+ * computed with the bank.
+ */
+static void benchmark_filter_bank(void)
+{
+  image_view_t eq = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t lp = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t hp = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  const image_view_t *outputs[2] = { &lp, &hp };
+  static const box_combination_t filters[2] = { BOX_LOW_PASS_3X3, BOX_HIGH_PASS_3X3 };
+
+  uint32_t start = DWT->CYCCNT;
+  apply_2d_convolution(&eq, &lp, low_pass_kernel_3x3, 3);
+  apply_2d_convolution(&eq, &hp, high_pass_kernel_3x3, 3);
+  bench_bank_separate_cycles = DWT->CYCCNT - start;
+
+  // The graph's buf_lp / buf_hp hold the bank's output; they are only read
+  bench_bank_mismatches = 0;
+  for (int j = 0; j < IMAGE_SIZE; j++) {
+    if (bench_ref_out[j] != output_image_lp[j]) bench_bank_mismatches++;
+    if (bench_test_out[j] != output_image_hp[j]) bench_bank_mismatches++;
+  }
+
+  start = DWT->CYCCNT;
+  apply_box_filter_bank(&eq, outputs, filters, 2, 3, box_col_sums);
+  bench_bank_fused_cycles = DWT->CYCCNT - start;
+}
+
+// Largest per-pixel difference between two benchmark outputs
+static uint32_t max_deviation(const uint8_t *a, const uint8_t *b)
+{
+  uint32_t max = 0;
+  for (int j = 0; j < IMAGE_SIZE; j++) {
+    uint32_t d = (a[j] > b[j]) ? a[j] - b[j] : b[j] - a[j];
+    if (d > max) max = d;
+  }
+  return max;
 }
-void apply_median_filtering(const uint8_t *input_image, uint8_t *output_image,
-                            int height, int width, int kernel_size) {
 
-    int center = kernel_size / 2;
-    uint8_t window[WINDOW_SIZE];
+/*
+ * Fixed-point convolution: cycles of both paths and the largest difference
+ * from the float output, for the HW2 kernels and for 5x5 and 7x7 means.
+ */
+static void benchmark_q15(void)
+{
+  static const int sizes[NUM_Q15_KERNELS] = { 3, 3, 5, 7 };
+  image_view_t eq = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t ref = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t test = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  conv_q15_t q;
+
+  for (int n = 0; n < NUM_Q15_KERNELS; n++) {
+    int k = sizes[n];
+    const float *kernel = box_kernel;
+    if (n == 0) kernel = low_pass_kernel_3x3;
+    else if (n == 1) kernel = high_pass_kernel_3x3;
+    else for (int i = 0; i < k * k; i++) box_kernel[i] = 1.0f / (float)(k * k);
+
+    uint32_t start = DWT->CYCCNT;
+    apply_2d_convolution(&eq, &ref, kernel, k);
+    bench_q15_float_cycles[n] = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    conv_q15_init(&q, kernel, k);
+    apply_2d_convolution_q15(&q, &eq, &test, q15_rows);
+    bench_q15_cycles[n] = DWT->CYCCNT - start;
+
+    bench_q15_max_deviation[n] = max_deviation(bench_ref_out, bench_test_out);
+  }
+}
 
-    for (int y = 0; y < height; y++) {
-        for (int x = 0; x < width; x++) {
-            int window_idx = 0;
+/*
+ * Salt-and-pepper cleanup at growing window sizes: the sorting median
+ * against the constant-time histogram median, on the equalized image with
+ * about 5% of the pixels forced to 0 or 255.
+ */
+static void benchmark_median(void)
+{
+  image_view_t noisy = image_view_make(bench_noisy, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t ref = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t test = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  uint32_t seed = 12345;
+
+  for (int j = 0; j < IMAGE_SIZE; j++) {
+    seed = seed * 1664525u + 1013904223u;
+    uint32_t r = seed >> 24;
+    bench_noisy[j] = (r < 6) ? 0 : (r < 12) ? 255 : equalized_image[j];
+  }
 
+  for (int n = 0; n < NUM_MEDIAN_SIZES; n++) {
+    int k = median_sizes[n];
 
-            for (int j = 0; j < kernel_size; j++) {
-                for (int i = 0; i < kernel_size; i++) {
+    uint32_t start = DWT->CYCCNT;
+    apply_median_filtering(&noisy, &ref, k);
+    bench_median_sort_cycles[n] = DWT->CYCCNT - start;
 
-                    int image_y = y + j - center;
-                    int image_x = x + i - center;
+    start = DWT->CYCCNT;
+    apply_median_filtering_ct(&noisy, &test, k, median_workspace);
+    bench_median_ct_cycles[n] = DWT->CYCCNT - start;
 
+    bench_median_mismatches[n] = 0;
+    for (int j = 0; j < IMAGE_SIZE; j++) {
+      if (bench_ref_out[j] != bench_test_out[j]) bench_median_mismatches[n]++;
+    }
 
-                    if (image_y < 0) image_y = 0;
-                    if (image_y >= height) image_y = height - 1;
-                    if (image_x < 0) image_x = 0;
-                    if (image_x >= width) image_x = width - 1;
+    if (k == 3) {
+      start = DWT->CYCCNT;
+      apply_median3(&noisy, &test, median3_line_buf);
+      bench_median3_cycles = DWT->CYCCNT - start;
 
+      bench_median3_mismatches = 0;
+      for (int j = 0; j < IMAGE_SIZE; j++) {
+        if (bench_ref_out[j] != bench_test_out[j]) bench_median3_mismatches++;
+      }
+    }
+  }
+}
 
-                    window[window_idx++] = input_image[image_y * width + image_x];
-                }
-            }
+/*
+ * Direct against separable and FFT convolution on the equalized image, to
+ * find the kernel sizes where conv_plan_init() should switch strategy.
+ */
+static void benchmark_conv_plan(void)
+{
+  image_view_t eq = image_view_make(equalized_image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t ref = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t test = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  float *kernel = box_kernel;
+  uint32_t seed = 1;
+
+  for (int n = 0; n < NUM_CONV_SIZES; n++) {
+    int k = conv_sizes[n];
+    float binomial[MAX_CONV_SIZE];
+    float sum = 0.0f;
+
+    // Row k - 1 of Pascal's triangle
+    binomial[0] = 1.0f;
+    for (int i = 1; i < k; i++) binomial[i] = binomial[i - 1] * (float)(k - i) / (float)i;
+    for (int i = 0; i < k; i++) sum += binomial[i];
+    for (int j = 0; j < k; j++) {
+      for (int i = 0; i < k; i++) kernel[j * k + i] = binomial[j] * binomial[i] / (sum * sum);
+    }
 
+    uint32_t start = DWT->CYCCNT;
+    apply_2d_convolution(&eq, &ref, kernel, k);
+    bench_conv_binomial_direct_cycles[n] = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    conv_plan_init(&conv_plan, kernel, k, IMAGE_WIDTH, CONV_SEPARABLE, conv_workspace);
+    conv_plan_apply(&conv_plan, &eq, &test);
+    bench_conv_separable_cycles[n] = DWT->CYCCNT - start;
+    bench_conv_max_deviation[n] = max_deviation(bench_ref_out, bench_test_out);
+
+    // Positive random weights summing to one
+    sum = 0.0f;
+    for (int i = 0; i < k * k; i++) {
+      seed = seed * 1664525u + 1013904223u;
+      kernel[i] = (float)((seed >> 16) & 0xFF) + 1.0f;
+      sum += kernel[i];
+    }
+    for (int i = 0; i < k * k; i++) kernel[i] /= sum;
+
+    start = DWT->CYCCNT;
+    apply_2d_convolution(&eq, &ref, kernel, k);
+    bench_conv_random_direct_cycles[n] = DWT->CYCCNT - start;
+
+    start = DWT->CYCCNT;
+    conv_plan_init(&conv_plan, kernel, k, IMAGE_WIDTH, CONV_FFT, conv_workspace);
+    conv_plan_apply(&conv_plan, &eq, &test);
+    bench_conv_fft_cycles[n] = DWT->CYCCNT - start;
+
+    uint32_t d = max_deviation(bench_ref_out, bench_test_out);
+    if (d > bench_conv_max_deviation[n]) bench_conv_max_deviation[n] = d;
+    bench_conv_auto_strategy[n] = conv_plan_init(&conv_plan, kernel, k, IMAGE_WIDTH, CONV_AUTO, conv_workspace);
+  }
+}
 
-            sort_window(window, WINDOW_SIZE);
+/*
+ * The two halves of CLAHE on the HW2 image: building the 16 tile tables,
+ * then mapping every row, which is what a streaming caller pays per frame.
+ */
+static void benchmark_clahe(void)
+{
+  image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+
+  clahe_init(&clahe, IMAGE_WIDTH, IMAGE_HEIGHT, CLAHE_TILES, CLAHE_TILES, CLAHE_CLIP_LIMIT, clahe_workspace);
+
+  uint32_t start = DWT->CYCCNT;
+  clahe_build(&clahe, &src, histogram_sub);
+  bench_clahe_build_cycles = DWT->CYCCNT - start;
 
+  start = DWT->CYCCNT;
+  for (uint32_t y = 0; y < IMAGE_HEIGHT; y++) {
+    clahe_map_row(&clahe, y, &image[y * IMAGE_WIDTH], &bench_test_out[y * IMAGE_WIDTH]);
+  }
+  bench_clahe_map_cycles = DWT->CYCCNT - start;
+}
 
-            output_image[y * width + x] = window[WINDOW_SIZE / 2];
-        }
+/*
+ * A sequence of the HW2 image alternately brightened and darkened by
+ * TEMPORAL_FLICKER levels. Cycles per frame of the two-pass equalization
+ * against the temporal one, and how far any table entry jumps from one
+ * frame to the next with and without smoothing.
+ */
+static void benchmark_temporal(void)
+{
+  static const uint16_t weights[2] = { 256, TEMPORAL_NEW_WEIGHT_Q8 };
+  image_view_t frame = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t out = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  uint8_t previous[NUM_GRAY_LEVELS];
+
+  for (int w = 0; w < 2; w++) {
+    uint32_t max_step = 0;
+    equalize_temporal_init(&temporal_eq, weights[w]);
+
+    for (int f = 0; f < TEMPORAL_FRAMES; f++) {
+      int offset = (f & 1) ? TEMPORAL_FLICKER : -TEMPORAL_FLICKER;
+      for (int j = 0; j < IMAGE_SIZE; j++) {
+        int v = image[j] + offset;
+        bench_ref_out[j] = (uint8_t)((v < 0) ? 0 : (v > 255) ? 255 : v);
+      }
+
+      if (w == 0) {
+        uint32_t start = DWT->CYCCNT;
+        histogram_u8(&frame, temporal_histogram, histogram_sub);
+        equalize_lut(temporal_histogram, IMAGE_SIZE, temporal_lut);
+        equalize_apply(temporal_lut, &frame, &out);
+        bench_temporal_two_pass_cycles = DWT->CYCCNT - start;
+      }
+
+      memcpy(previous, temporal_eq.lut, NUM_GRAY_LEVELS);
+      uint32_t start = DWT->CYCCNT;
+      for (int y = 0; y < IMAGE_HEIGHT; y++) {
+        equalize_temporal_row(&temporal_eq, &bench_ref_out[y * IMAGE_WIDTH],
+                              &bench_test_out[y * IMAGE_WIDTH], IMAGE_WIDTH);
+      }
+      equalize_temporal_end_frame(&temporal_eq);
+      bench_temporal_cycles = DWT->CYCCNT - start;
+
+      // From the second table on; the first replaces the identity
+      for (int r = 0; f > 0 && r < NUM_GRAY_LEVELS; r++) {
+        uint32_t d = (temporal_eq.lut[r] > previous[r]) ? temporal_eq.lut[r] - previous[r]
+                                                          : previous[r] - temporal_eq.lut[r];
+        if (d > max_step) max_step = d;
+      }
     }
+    if (w == 0) bench_temporal_raw_step = max_step;
+    else bench_temporal_smoothed_step = max_step;
+  }
 }
-/* USER CODE END 0 */
 
-/**
-  * @brief  The application entry point.
-  * @retval int
-  */
-int main(void)
+/*
+ * Streams image through equalize -> {low-pass, high-pass, median} and
+ * compares each emitted row with the frame computed by the filter graph.
+ * Only STREAM_PIPELINE_BUFFER_SIZE(IMAGE_WIDTH) bytes are used besides
+ * the source.
+ */
+static int memory_row_source(void *ctx, uint32_t y, uint8_t *row, uint16_t width)
 {
-  /* USER CODE BEGIN 1 */
-	for (int i = 0; i < 256; i++) {
-	        histogram[i] = 0;
-	    }
-	for(int i=0; i<IMAGE_SIZE; i++){
-		histogram[image[i]]++;
-	}
-	for(int i=0; i<NUM_GRAY_LEVELS; i++){
-		cdf[i]=0;
-	}
-	cdf[0] = (float)histogram[0] / IMAGE_SIZE;
-	for(int i=1; i<NUM_GRAY_LEVELS;i++){
+  memcpy(row, (const uint8_t *)ctx + y * width, width);
+  return 0;
+}
 
-	    cdf[i] = cdf[i-1] + ((float)histogram[i] / (float)IMAGE_SIZE);
-	}
+// ctx: the mismatch counter to increment
+static void compare_row_sink(void *ctx, stream_output_t output, uint32_t y,
+                             const uint8_t *row, uint16_t width)
+{
+  volatile uint32_t *mismatches = ctx;
+  const uint8_t *ref = equalized_image;
+  if (output == STREAM_LOW_PASS) ref = output_image_lp;
+  else if (output == STREAM_HIGH_PASS) ref = output_image_hp;
+  else if (output == STREAM_MEDIAN) ref = output_image_med;
+
+  for (int x = 0; x < width; x++) {
+    if (row[x] != ref[y * width + x]) (*mismatches)++;
+  }
+}
 
-	int i = 0;
-	while (i < NUM_GRAY_LEVELS && cdf[i] <= 0.0f) {
-	    i++;
-	}
+static void benchmark_stream(void)
+{
+  stream_pipeline_t p = {
+    .width = IMAGE_WIDTH, .height = IMAGE_HEIGHT,
+    .source = memory_row_source, .source_ctx = (void *)image,
+    .sink = compare_row_sink, .sink_ctx = (void *)&bench_stream_mismatches,
+    .outputs = STREAM_EQUALIZED | STREAM_LOW_PASS | STREAM_HIGH_PASS | STREAM_MEDIAN,
+    .eq_lut = equalization_lut,
+    .low_pass_kernel = low_pass_kernel_3x3, .high_pass_kernel = high_pass_kernel_3x3,
+  };
+
+  bench_stream_mismatches = 0;
+  uint32_t start = DWT->CYCCNT;
+  stream_pipeline_run(&p, stream_buf);
+  bench_stream_cycles = DWT->CYCCNT - start;
+  bench_stream_buffer_bytes = STREAM_PIPELINE_BUFFER_SIZE(IMAGE_WIDTH);
+}
 
-	float cdf_min = 0.0f;
-	if (i < NUM_GRAY_LEVELS) {
+/*
+ * The same check with the rows decoded from image_lz4, the input image
+ * compressed by HW1/image_to_header.py. The decoder adds its
+ * IMAGE_CODEC_WINDOW history to the pipeline buffer; no frame is decoded.
+ */
+static void benchmark_stream_lz4(void)
+{
+  stream_pipeline_t p = {
+    .width = IMAGE_WIDTH, .height = IMAGE_HEIGHT,
+    .source = image_decoder_row_source, .source_ctx = &stream_decoder,
+    .sink = compare_row_sink, .sink_ctx = (void *)&bench_stream_lz4_mismatches,
+    .outputs = STREAM_EQUALIZED | STREAM_LOW_PASS | STREAM_HIGH_PASS | STREAM_MEDIAN,
+    .eq_lut = equalization_lut,
+    .low_pass_kernel = low_pass_kernel_3x3, .high_pass_kernel = high_pass_kernel_3x3,
+  };
+
+  bench_stream_lz4_mismatches = 0;
+  uint32_t start = DWT->CYCCNT;
+  image_decoder_init(&stream_decoder, &image_lz4);
+  bench_stream_lz4_status = stream_pipeline_run(&p, stream_buf);
+  bench_stream_lz4_cycles = DWT->CYCCNT - start;
+  bench_stream_lz4_compressed_bytes = image_lz4.size;
+}
 
-	    cdf_min = cdf[i];
-	}
+#if STREAM_UART_FRAMES
+/*
+ * Frames of STREAM_UART_WIDTH x STREAM_UART_HEIGHT raw bytes arrive row by
+ * row on USART2, and each median-filtered row is sent back as soon as it is
+ * final. A frame never fits in RAM, so it is equalized with the smoothed
+ * table of the previous frames (identity for the first one).
+ *
+ * Both directions run by interrupt through row_transport.c: the next rows
+ * are received while a row is processed and the previous ones are sent, so
+ * the PC may send frames back to back with no flow control. If a frame
+ * breaks off (a receive error, or no row for STREAM_UART_TIMEOUT_MS), fewer
+ * than STREAM_UART_HEIGHT rows come back; the board then waits for the line
+ * to be idle for STREAM_UART_IDLE_MS and expects a new frame. The PC should
+ * do the same: stop sending, wait, and start the frame again.
+ */
+static int uart_start_receive(void *ctx, uint8_t *buf, uint32_t size)
+{
+  return (HAL_UART_Receive_IT(ctx, buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+}
 
-	float normalization_factor = 1.0f / (1.0f - cdf_min);
+static int uart_start_transmit(void *ctx, const uint8_t *buf, uint32_t size)
+{
+  return (HAL_UART_Transmit_IT(ctx, (uint8_t *)buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+}
 
-	for (int j = 0; j < IMAGE_SIZE; j++) {
-	    uint8_t r_k = image[j];
-	    float cdf_r_k = cdf[r_k];
+static void uart_abort_receive(void *ctx) { HAL_UART_AbortReceive(ctx); }
+static void irq_lock(void *ctx) { (void)ctx; __disable_irq(); }
+static void irq_unlock(void *ctx) { (void)ctx; __enable_irq(); }
+// Called with interrupts masked: __WFI() wakes on the pending one, which runs at unlock
+static void wait_for_interrupt(void *ctx) { (void)ctx; __WFI(); }
+static uint32_t tick_ms(void *ctx) { (void)ctx; return HAL_GetTick(); }
 
-	    float s_k_float;
+static const row_port_t uart_row_port = {
+  uart_start_receive, uart_start_transmit, uart_abort_receive,
+  irq_lock, irq_unlock, wait_for_interrupt, tick_ms, &huart2
+};
 
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart == &huart2) row_transport_rx_complete(&stream_uart_transport);
+}
 
-	    if (cdf_r_k == cdf_min) {
-	        s_k_float = 0.0f;
-	    } else {
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart == &huart2) row_transport_tx_complete(&stream_uart_transport);
+}
 
-	        s_k_float = (cdf_r_k - cdf_min) * normalization_factor * 255.0f;
-	    }
+// HAL sets the state of a direction it stopped back to READY
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart != &huart2) return;
+  uint32_t stopped = 0;
+  if (huart->RxState != HAL_UART_STATE_BUSY_RX) stopped |= ROW_ERROR_RX;
+  if (huart->gState != HAL_UART_STATE_BUSY_TX) stopped |= ROW_ERROR_TX;
+  row_transport_error(&stream_uart_transport, stopped);
+}
 
+static int uart_row_source(void *ctx, uint32_t y, uint8_t *row, uint16_t width)
+{
+  (void)y;
+  (void)width;
+  return row_transport_read(ctx, row, STREAM_UART_TIMEOUT_MS);
+}
 
-	    int result = (int)(s_k_float + 0.5f);
-	    if (result > 255) result = 255;
-	    if (result < 0) result = 0;
+static void uart_row_sink(void *ctx, stream_output_t output, uint32_t y,
+                          const uint8_t *row, uint16_t width)
+{
+  (void)output;
+  (void)y;
+  (void)width;
+  row_transport_write(ctx, row);
+}
 
+static void stream_uart_frame(void)
+{
+  stream_pipeline_t p = {
+    .width = STREAM_UART_WIDTH, .height = STREAM_UART_HEIGHT,
+    .source = uart_row_source, .source_ctx = &stream_uart_transport,
+    .sink = uart_row_sink, .sink_ctx = &stream_uart_transport,
+    .outputs = STREAM_MEDIAN,
+    .eq_lut = stream_uart_eq.lut,
+    .histogram = stream_uart_eq.histogram,
+  };
+  if (stream_pipeline_run(&p, stream_uart_buf) == 0) {
+    equalize_temporal_end_frame(&stream_uart_eq);
+    stream_uart_frames++;
+  } else {
+    // Partial frame: keep the current table and wait for the next frame
+    memset(stream_uart_eq.histogram, 0, sizeof(stream_uart_eq.histogram));
+    row_transport_resync(&stream_uart_transport, STREAM_UART_IDLE_MS);
+  }
+}
+#endif
 
-	    equalized_image[j] = (uint8_t)result;
-	}
+/*
+ * Equalization of the input image with the float reference table and with
+ * the integer table, each built and applied to the whole image.
+ */
+static void benchmark_equalize(void)
+{
+  uint8_t lut[NUM_GRAY_LEVELS];
+  image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t ref = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t test = image_view_make(bench_test_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+
+  uint32_t start = DWT->CYCCNT;
+  equalize_lut_float(histogram, IMAGE_SIZE, lut);
+  equalize_apply(lut, &src, &ref);
+  bench_equalize_float_cycles = DWT->CYCCNT - start;
+
+  start = DWT->CYCCNT;
+  equalize_lut(histogram, IMAGE_SIZE, lut);
+  equalize_apply(lut, &src, &test);
+  bench_equalize_int_cycles = DWT->CYCCNT - start;
+
+  bench_equalize_mismatches = 0;
+  for (int j = 0; j < IMAGE_SIZE; j++) {
+    if (bench_ref_out[j] != bench_test_out[j]) bench_equalize_mismatches++;
+  }
+}
 
-	uint32_t equalized_histogram[NUM_GRAY_LEVELS] = {0};
-	for(int j=0; j<IMAGE_SIZE; j++){
+/*
+ * Runs median3(equalize(image)) > otsu twice and reports cycles and image
+ * traffic for both: once with every stage writing a full image, once as two
+ * pipeline_run() passes (histogram of the median, then the thresholded
+ * store) that only keep a 3-row line buffer.
+ */
+static void benchmark_pipeline(void)
+{
+  uint32_t hist[NUM_GRAY_LEVELS];
+  uint8_t eq_lut[NUM_GRAY_LEVELS];
+  uint8_t thr_lut[NUM_GRAY_LEVELS];
+  image_view_t src = image_view_make(image, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t eq = image_view_make(bench_ref_out, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t med = image_view_make(pipeline_med, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+  image_view_t fused = image_view_make(pipeline_fused, IMAGE_WIDTH, IMAGE_HEIGHT, PIXEL_U8);
+
+  // Unfused: the equalized image (in bench_ref_out, not the graph's
+  // equalized_image) and pipeline_med are full intermediates
+  uint32_t start = DWT->CYCCNT;
+  histogram_u8(&src, hist, histogram_sub);
+  equalize_lut(hist, IMAGE_SIZE, eq_lut);
+  for (int j = 0; j < IMAGE_SIZE; j++) bench_ref_out[j] = eq_lut[image[j]];
+  apply_median_filtering(&eq, &med, MEDIAN_KERNEL_SIZE);
+  histogram_u8(&med, hist, histogram_sub);
+  uint8_t thr = otsu_threshold(hist, IMAGE_SIZE);
+  for (int j = 0; j < IMAGE_SIZE; j++) pipeline_unfused[j] = (pipeline_med[j] > thr) ? 255 : 0;
+  bench_unfused_cycles = DWT->CYCCNT - start;
+  // histogram, equalize, 9 taps per median, histogram, threshold
+  bench_unfused_bytes_read = IMAGE_SIZE * (1 + 1 + WINDOW_TAPS + 1 + 1);
+  bench_unfused_bytes_written = IMAGE_SIZE * 3;
+  bench_unfused_buffer_bytes = IMAGE_SIZE * 2;
+
+  // Fused: the median output is only ever seen by the histogram and the store LUT
+  pipeline_stats_t stats = {0};
+  start = DWT->CYCCNT;
+  histogram_u8(&src, hist, histogram_sub);
+  stats.bytes_read += IMAGE_SIZE;
+  equalize_lut(hist, IMAGE_SIZE, eq_lut);
+  memset(hist, 0, sizeof(hist));
+  pipeline_t pass1 = { .load_lut = eq_lut, .op = PIPELINE_MEDIAN3, .histogram = hist };
+  pipeline_run(&pass1, &src, NULL, pipeline_line_buf, &stats);
+  threshold_lut(otsu_threshold(hist, IMAGE_SIZE), thr_lut);
+  pipeline_t pass2 = { .load_lut = eq_lut, .op = PIPELINE_MEDIAN3, .store_lut = thr_lut };
+  pipeline_run(&pass2, &src, &fused, pipeline_line_buf, &stats);
+  bench_fused_cycles = DWT->CYCCNT - start;
+  bench_fused_bytes_read = stats.bytes_read;
+  bench_fused_bytes_written = stats.bytes_written;
+  bench_fused_buffer_bytes = stats.buffer_bytes;
+
+  bench_pipeline_mismatches = 0;
+  for (int j = 0; j < IMAGE_SIZE; j++) {
+    if (pipeline_fused[j] != pipeline_unfused[j]) bench_pipeline_mismatches++;
+  }
+}
+/* USER CODE END 0 */
 
-	    equalized_histogram[equalized_image[j]]++;
-	    apply_2d_convolution(equalized_image, output_image_lp,IMAGE_HEIGHT, IMAGE_WIDTH,low_pass_kernel_3x3, 3);
-	    apply_2d_convolution(equalized_image, output_image_hp,IMAGE_HEIGHT, IMAGE_WIDTH,high_pass_kernel_3x3, 3);
-	    apply_median_filtering(equalized_image, output_image_med, IMAGE_HEIGHT, IMAGE_WIDTH,3);
-	}
+/**
+  * @brief  The application entry point.
+  * @retval int
+  */
+int main(void)
+{
+  /* USER CODE BEGIN 1 */
+	cycle_counter_init();
+
+	// First run: every stage executes once
+	uint32_t start = DWT->CYCCNT;
+	filter_graph_run(&hw2_graph);
+	bench_graph_cycles = DWT->CYCCNT - start;
+
+	// Nothing changed, so every stage is skipped
+	start = DWT->CYCCNT;
+	filter_graph_run(&hw2_graph);
+	bench_graph_rerun_cycles = DWT->CYCCNT - start;
+	bench_graph_executed = hw2_graph.executed;
+	bench_graph_skipped = hw2_graph.skipped;
+
+	benchmark_equalize();
+	benchmark_box_filter();
+	benchmark_filter_bank();
+	benchmark_q15();
+	benchmark_median();
+	benchmark_conv_plan();
+	benchmark_clahe();
+	benchmark_temporal();
+	benchmark_pipeline();
+	benchmark_stream();
+	benchmark_stream_lz4();
 
   /* USER CODE END 1 */
 
@@ -261,7 +899,11 @@ int main(void)
   MX_GPIO_Init();
   MX_USART2_UART_Init();
   /* USER CODE BEGIN 2 */
-
+#if STREAM_UART_FRAMES
+  equalize_temporal_init(&stream_uart_eq, TEMPORAL_NEW_WEIGHT_Q8);
+  row_transport_init(&stream_uart_transport, &uart_row_port, STREAM_UART_WIDTH, stream_uart_rows);
+  row_transport_start(&stream_uart_transport);
+#endif
   /* USER CODE END 2 */
 
   /* Infinite loop */
@@ -271,6 +913,9 @@ int main(void)
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
+#if STREAM_UART_FRAMES
+    stream_uart_frame();
+#endif
   }
   /* USER CODE END 3 */
 }
@@ -0,0 +1,108 @@
+/*
+ * pipeline.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "pipeline.h"
+#include "pixel_math.h"
+#include "spatial_filters.h"
+
+// Copy source row y into its line-buffer slot through the load LUT
+static void load_row(const pipeline_t *p, const image_view_t *src, uint8_t *line_buf, int y)
+{
+    const uint8_t *in = IMAGE_VIEW_ROW_U8(src, y);
+    uint8_t *slot = &line_buf[(y % PIPELINE_KERNEL_SIZE) * src->width];
+
+    if (p->load_lut) {
+        for (int x = 0; x < src->width; x++) slot[x] = p->load_lut[in[x]];
+    } else {
+        memcpy(slot, in, src->width);
+    }
+}
+
+void pipeline_run(const pipeline_t *p, const image_view_t *src, const image_view_t *dst,
+                  uint8_t *line_buf, pipeline_stats_t *stats)
+{
+    int height = src->height;
+    int width = src->width;
+    int center = PIPELINE_KERNEL_SIZE / 2;
+    int next_row = 0;   // next source row to load into the line buffer
+
+    for (int y = 0; y < height; y++) {
+        // Rows y - 1 .. y + 1 (clamped) must be in the line buffer
+        int last = clamp_index(y + center, height);
+        while (next_row <= last) load_row(p, src, line_buf, next_row++);
+
+        const uint8_t *rows[PIPELINE_KERNEL_SIZE];
+        for (int j = 0; j < PIPELINE_KERNEL_SIZE; j++) {
+            rows[j] = &line_buf[(clamp_index(y + j - center, height) % PIPELINE_KERNEL_SIZE) * width];
+        }
+        uint8_t *out = dst ? IMAGE_VIEW_ROW_U8(dst, y) : NULL;
+
+        for (int x = 0; x < width; x++) {
+            uint8_t value;
+
+            if (p->op == PIPELINE_NONE) {
+                value = rows[center][x];
+            } else {
+                uint8_t window[PIPELINE_KERNEL_SIZE * PIPELINE_KERNEL_SIZE];
+                float sum = 0.0f;
+                int k = 0;
+
+                for (int j = 0; j < PIPELINE_KERNEL_SIZE; j++) {
+                    for (int i = 0; i < PIPELINE_KERNEL_SIZE; i++, k++) {
+                        uint8_t px = rows[j][clamp_index(x + i - center, width)];
+                        if (p->op == PIPELINE_MEDIAN3) window[k] = px;
+                        else sum += (float)px * p->kernel[k];
+                    }
+                }
+                if (p->op == PIPELINE_MEDIAN3) {
+                    sort_window(window, PIPELINE_KERNEL_SIZE * PIPELINE_KERNEL_SIZE);
+                    value = window[PIPELINE_KERNEL_SIZE * PIPELINE_KERNEL_SIZE / 2];
+                } else {
+                    value = store_u8(sum);
+                }
+            }
+
+            if (p->store_lut) value = p->store_lut[value];
+            if (p->histogram) p->histogram[value]++;
+            if (out) out[x] = value;
+        }
+    }
+
+    if (stats) {
+        uint32_t pixels = (uint32_t)width * height;
+        uint32_t line_bytes = PIPELINE_LINE_BUFFER_SIZE(width);
+
+        // Line-buffer accesses are not counted, only source and dst pixels
+        stats->bytes_read += pixels;
+        if (dst) stats->bytes_written += pixels;
+        if (line_bytes > stats->buffer_bytes) stats->buffer_bytes = line_bytes;
+    }
+}
+
+// Otsu's method as in HW3's compute_otsu(), from an existing histogram
+uint8_t otsu_threshold(const uint32_t *histogram, uint32_t total)
+{
+    float sum = 0, sumB = 0, varMax = 0;
+    for (int i = 0; i < 256; i++) sum += (float)i * histogram[i];
+    uint32_t wB = 0, wF = 0;
+    uint8_t threshold = 0;
+    for (int i = 0; i < 256; i++) {
+        wB += histogram[i]; if (wB == 0) continue;
+        wF = total - wB; if (wF == 0) break;
+        sumB += (float)(i * histogram[i]);
+        float mB = sumB / (float)wB, mF = (sum - sumB) / (float)wF;
+        float varBetween = (float)wB * (float)wF * (mB - mF) * (mB - mF);
+        if (varBetween > varMax) { varMax = varBetween; threshold = (uint8_t)i; }
+    }
+    return threshold;
+}
+
+void threshold_lut(uint8_t threshold, uint8_t *lut)
+{
+    for (int r = 0; r < 256; r++) lut[r] = (r > threshold) ? 255 : 0;
+}
@@ -0,0 +1,153 @@
+/*
+ * real_fft.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <math.h>
+#include "real_fft.h"
+
+#if defined(ARM_MATH_CM4)
+
+int real_fft_init(real_fft_t *f, uint32_t size, float *twiddles)
+{
+    (void)twiddles;     // CMSIS keeps its tables in flash
+    f->size = size;
+    return (arm_rfft_fast_init_f32(&f->cmsis, (uint16_t)size) == ARM_MATH_SUCCESS) ? 0 : -1;
+}
+
+void real_fft_forward(const real_fft_t *f, float *in, float *out)
+{
+    arm_rfft_fast_f32((arm_rfft_fast_instance_f32 *)&f->cmsis, in, out, 0);
+}
+
+void real_fft_inverse(const real_fft_t *f, float *in, float *out)
+{
+    arm_rfft_fast_f32((arm_rfft_fast_instance_f32 *)&f->cmsis, in, out, 1);
+}
+
+#else
+
+int real_fft_init(real_fft_t *f, uint32_t size, float *twiddles)
+{
+    if (size < REAL_FFT_MIN_SIZE || size > REAL_FFT_MAX_SIZE || (size & (size - 1)) != 0) {
+        return -1;
+    }
+    for (uint32_t k = 0; k < size / 2; k++) {
+        double a = -2.0 * M_PI * (double)k / (double)size;
+        twiddles[2 * k] = (float)cos(a);
+        twiddles[2 * k + 1] = (float)sin(a);
+    }
+    f->size = size;
+    f->twiddles = twiddles;
+    return 0;
+}
+
+/*
+ * In-place radix-2 FFT of m = N/2 interleaved complex points. Twiddle
+ * W_m^j is W_N^(2j), entry 2j of the table; the inverse uses conjugates
+ * and is not scaled.
+ */
+static void complex_fft(const real_fft_t *f, float *z, int inverse)
+{
+    uint32_t m = f->size / 2;
+
+    for (uint32_t i = 1, j = 0; i < m; i++) {
+        uint32_t bit = m >> 1;
+        for (; j & bit; bit >>= 1) j ^= bit;
+        j |= bit;
+        if (i < j) {
+            float re = z[2 * i], im = z[2 * i + 1];
+            z[2 * i] = z[2 * j];
+            z[2 * i + 1] = z[2 * j + 1];
+            z[2 * j] = re;
+            z[2 * j + 1] = im;
+        }
+    }
+
+    for (uint32_t len = 2; len <= m; len <<= 1) {
+        uint32_t step = 2 * (m / len);      // table stride in complex entries
+        for (uint32_t start = 0; start < m; start += len) {
+            for (uint32_t k = 0; k < len / 2; k++) {
+                float wr = f->twiddles[2 * k * step];
+                float wi = f->twiddles[2 * k * step + 1];
+                if (inverse) wi = -wi;
+
+                float *a = &z[2 * (start + k)];
+                float *b = &z[2 * (start + k + len / 2)];
+                float tr = b[0] * wr - b[1] * wi;
+                float ti = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - tr;
+                b[1] = a[1] - ti;
+                a[0] += tr;
+                a[1] += ti;
+            }
+        }
+    }
+}
+
+/*
+ * The even and odd samples are the real and imaginary parts of one N/2
+ * point complex FFT Z. With E and O their own spectra,
+ *     E[k] = (Z[k] + conj(Z[N/2 - k])) / 2,
+ *     O[k] = (Z[k] - conj(Z[N/2 - k])) / 2i,
+ *     X[k] = E[k] + W_N^k O[k].
+ */
+void real_fft_forward(const real_fft_t *f, float *in, float *out)
+{
+    uint32_t m = f->size / 2;
+
+    complex_fft(f, in, 0);
+    out[0] = in[0] + in[1];
+    out[1] = in[0] - in[1];
+
+    for (uint32_t k = 1; k < m; k++) {
+        float ar = in[2 * k], ai = in[2 * k + 1];
+        float br = in[2 * (m - k)], bi = -in[2 * (m - k) + 1];
+        float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        float or_ = 0.5f * (ai - bi), oi = -0.5f * (ar - br);
+        float wr = f->twiddles[2 * k], wi = f->twiddles[2 * k + 1];
+        out[2 * k] = er + wr * or_ - wi * oi;
+        out[2 * k + 1] = ei + wr * oi + wi * or_;
+    }
+}
+
+// Reverses the split: Z[k] = E[k] + i O[k], then an inverse N/2 point FFT
+void real_fft_inverse(const real_fft_t *f, float *in, float *out)
+{
+    uint32_t m = f->size / 2;
+    float scale = 1.0f / (float)m;
+
+    for (uint32_t k = 0; k < m; k++) {
+        float ar, ai, br, bi;
+        if (k == 0) {
+            ar = in[0]; ai = 0.0f;
+            br = in[1]; bi = 0.0f;      // conj(X[N/2])
+        } else {
+            ar = in[2 * k]; ai = in[2 * k + 1];
+            br = in[2 * (m - k)]; bi = -in[2 * (m - k) + 1];
+        }
+        float er = 0.5f * (ar + br), ei = 0.5f * (ai + bi);
+        float dr = 0.5f * (ar - br), di = 0.5f * (ai - bi);
+        float wr = f->twiddles[2 * k], wi = -f->twiddles[2 * k + 1];
+        float or_ = dr * wr - di * wi, oi = dr * wi + di * wr;
+        out[2 * k] = er - oi;
+        out[2 * k + 1] = ei + or_;
+    }
+
+    complex_fft(f, out, 1);
+    for (uint32_t i = 0; i < f->size; i++) out[i] *= scale;
+}
+
+#endif
+
+void real_fft_multiply_add(const float *a, const float *b, float *acc, uint32_t size)
+{
+    acc[0] += a[0] * b[0];
+    acc[1] += a[1] * b[1];
+    for (uint32_t i = 2; i < size; i += 2) {
+        acc[i] += a[i] * b[i] - a[i + 1] * b[i + 1];
+        acc[i + 1] += a[i] * b[i + 1] + a[i + 1] * b[i];
+    }
+}
@@ -0,0 +1,162 @@
+/*
+ * row_transport.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "row_transport.h"
+
+/* The helpers below run with the lock held, or in the interrupt */
+
+// Receives the next row if its slot is free; a failed start is retried by wait_locked()
+static void receive_next(row_transport_t *t)
+{
+    if (t->rx_busy || !t->rx_running || t->rx_failed) return;
+    if (t->rx_head - t->rx_tail >= ROW_TRANSPORT_RX_ROWS) {
+        t->rx_stalls++;
+        return;
+    }
+    uint8_t *slot = t->rx_rows + (t->rx_head % ROW_TRANSPORT_RX_ROWS) * t->width;
+    t->rx_busy = 1;
+    if (t->port->start_receive(t->port->ctx, slot, t->width) != 0) {
+        t->rx_busy = 0;
+        t->errors++;
+    }
+}
+
+static void transmit_next(row_transport_t *t)
+{
+    if (t->tx_busy || t->tx_head == t->tx_tail) return;
+    const uint8_t *slot = t->tx_rows + (t->tx_tail % ROW_TRANSPORT_TX_ROWS) * t->width;
+    t->tx_busy = 1;
+    if (t->port->start_transmit(t->port->ctx, slot, t->width) != 0) {
+        t->tx_busy = 0;
+        t->errors++;
+    }
+}
+
+/* Called locked when the caller has to wait: retries transfers that could
+ * not be started, then sleeps until an event. wait() runs under the lock, so
+ * a transfer that completes after the caller's check still wakes it; the
+ * interrupt itself runs between unlock() and lock(). */
+static void wait_locked(row_transport_t *t)
+{
+    if (!t->rx_busy && t->rx_head - t->rx_tail < ROW_TRANSPORT_RX_ROWS) receive_next(t);
+    transmit_next(t);
+    t->port->wait(t->port->ctx);
+    t->port->unlock(t->port->ctx);
+    t->port->lock(t->port->ctx);
+}
+
+void row_transport_init(row_transport_t *t, const row_port_t *port, uint16_t width,
+                        uint8_t *buffer)
+{
+    t->port = port;
+    t->width = width;
+    t->rx_rows = buffer;
+    t->tx_rows = buffer + (uint32_t)ROW_TRANSPORT_RX_ROWS * width;
+    t->rx_head = t->rx_tail = t->tx_head = t->tx_tail = 0;
+    t->rx_running = t->rx_busy = t->tx_busy = t->rx_failed = 0;
+    t->rx_stalls = t->errors = 0;
+}
+
+void row_transport_start(row_transport_t *t)
+{
+    t->port->lock(t->port->ctx);
+    t->rx_head = t->rx_tail = 0;
+    t->rx_failed = 0;
+    t->rx_running = 1;
+    receive_next(t);
+    t->port->unlock(t->port->ctx);
+}
+
+void row_transport_stop(row_transport_t *t)
+{
+    t->port->lock(t->port->ctx);
+    t->rx_running = 0;
+    t->port->unlock(t->port->ctx);
+    // No row completes after this; a partial one is dropped
+    t->port->abort_receive(t->port->ctx);
+    t->rx_busy = 0;
+}
+
+int row_transport_read(row_transport_t *t, uint8_t *row, uint32_t timeout_ms)
+{
+    uint32_t start = t->port->millis(t->port->ctx);
+
+    t->port->lock(t->port->ctx);
+    while (t->rx_head == t->rx_tail && !t->rx_failed &&
+           t->port->millis(t->port->ctx) - start < timeout_ms) {
+        wait_locked(t);
+    }
+    int ok = t->rx_head != t->rx_tail && !t->rx_failed;
+    t->port->unlock(t->port->ctx);
+    if (!ok) return -1;
+
+    // The receive in progress, if any, fills another slot
+    if (row != NULL) {
+        memcpy(row, t->rx_rows + (t->rx_tail % ROW_TRANSPORT_RX_ROWS) * t->width, t->width);
+    }
+    t->port->lock(t->port->ctx);
+    t->rx_tail++;
+    receive_next(t);
+    t->port->unlock(t->port->ctx);
+    return 0;
+}
+
+void row_transport_resync(row_transport_t *t, uint32_t idle_ms)
+{
+    do {
+        row_transport_stop(t);
+        row_transport_start(t);
+        while (row_transport_read(t, NULL, idle_ms) == 0) {}
+    } while (t->rx_failed);
+    // The line was idle; drop the partial row, if any, and start afresh
+    row_transport_stop(t);
+    row_transport_start(t);
+}
+
+void row_transport_write(row_transport_t *t, const uint8_t *row)
+{
+    t->port->lock(t->port->ctx);
+    while (t->tx_head - t->tx_tail >= ROW_TRANSPORT_TX_ROWS) wait_locked(t);
+    t->port->unlock(t->port->ctx);
+    // The row being sent, if any, is in another slot
+    memcpy(t->tx_rows + (t->tx_head % ROW_TRANSPORT_TX_ROWS) * t->width, row, t->width);
+    t->port->lock(t->port->ctx);
+    t->tx_head++;
+    transmit_next(t);
+    t->port->unlock(t->port->ctx);
+}
+
+void row_transport_rx_complete(row_transport_t *t)
+{
+    t->rx_busy = 0;
+    if (!t->rx_running) return;
+    t->rx_head++;
+    receive_next(t);
+}
+
+void row_transport_tx_complete(row_transport_t *t)
+{
+    t->tx_busy = 0;
+    t->tx_tail++;
+    transmit_next(t);
+}
+
+void row_transport_error(row_transport_t *t, uint32_t stopped)
+{
+    t->errors++;
+    if ((stopped & ROW_ERROR_RX) && t->rx_busy) {
+        // Bytes were lost: the rows that follow are misaligned
+        t->rx_busy = 0;
+        t->rx_failed = 1;
+    }
+    if ((stopped & ROW_ERROR_TX) && t->tx_busy) {
+        t->tx_busy = 0;
+        transmit_next(t);
+    }
+}
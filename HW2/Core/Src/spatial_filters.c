@@ -0,0 +1,448 @@
+/*
+ * spatial_filters.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stddef.h>
+#include <string.h>
+#include "spatial_filters.h"
+#include "pixel_math.h"
+
+/*
+ * Output conversion of the convolution sum for each pixel type: integer
+ * types are rounded and clamped to their range, float is stored as is.
+ * store_u8() is in pixel_math.h, shared with the other 8-bit paths.
+ */
+static inline uint16_t store_u16(float sum)
+{
+    int result = (int)(sum + 0.5f);
+
+    if (result < 0) result = 0;
+    if (result > (int)PIXEL_U16_MAX) result = PIXEL_U16_MAX;
+    return (uint16_t)result;
+}
+
+static inline float store_f32(float sum)
+{
+    return sum;
+}
+
+static const border_t border_replicate = { BORDER_REPLICATE, 0.0f };
+
+/*
+ * Row y of a view, signed so that BORDER_PADDED can reach the ghost rows
+ * above the view.
+ */
+#define VIEW_ROW(T, v, y) \
+    ((const T *)((const uint8_t *)(v)->data + (int32_t)(y) * (int32_t)(v)->stride))
+
+/*
+ * Coordinate v of a tap mapped into 0..n-1 for the border mode, or -1 for
+ * a tap that takes the constant value. Only the border path calls this.
+ */
+static inline int border_index(int v, int n, border_mode_t mode)
+{
+    if (v >= 0 && v < n) return v;
+    switch (mode) {
+    case BORDER_REFLECT:
+        if (n == 1) return 0;
+        v = (v < 0) ? -v : 2 * (n - 1) - v;
+        return clamp_index(v, n);   // only kernels larger than the view reach here
+    case BORDER_CONSTANT:
+        return -1;
+    case BORDER_PADDED:
+        return v;
+    default:
+        return clamp_index(v, n);
+    }
+}
+
+/*
+ * The frame is split into the interior, where every tap of the kernel is
+ * inside the view and taps are read with plain pointer offsets, and the
+ * border strips of kernel_size / 2 pixels, where each tap goes through
+ * border_index(). Rows y < pad and y >= height - pad are border rows; the
+ * other rows are border in x < x0 and x >= x1. With BORDER_PADDED the whole
+ * view is interior.
+ */
+typedef struct {
+    int pad;
+    int x0;
+    int x1;
+} regions_t;
+
+static inline regions_t split_regions(const image_view_t *src, int r, const border_t *border)
+{
+    regions_t g;
+    int w = src->width;
+
+    g.pad = (border->mode == BORDER_PADDED) ? 0 : r;
+    g.x0 = (g.pad < w) ? g.pad : w;
+    g.x1 = (w - g.pad > g.x0) ? w - g.pad : g.x0;
+    return g;
+}
+
+/*
+ * One definition of each filter, expanded once per pixel type so every
+ * instantiation is a separate, fully typed loop with no per-pixel dispatch.
+ * The taps are visited in the same order in both paths, so the sums and
+ * the results do not depend on which path computed a pixel.
+ */
+#define DEFINE_CONVOLUTION(NAME, T, STORE)                                      \
+static void NAME##_interior(const image_view_t *src, const image_view_t *dst,   \
+                            const float *kernel, int kernel_size,               \
+                            int y, int x0, int x1) {                            \
+    int center = kernel_size / 2;                                               \
+    T *out_row = (T *)VIEW_ROW(T, dst, y);                                      \
+                                                                                \
+    for (int x = x0; x < x1; x++) {                                             \
+        float sum = 0.0f;                                                       \
+        const float *k = kernel;                                                \
+                                                                                \
+        for (int j = 0; j < kernel_size; j++) {                                 \
+            const T *in = VIEW_ROW(T, src, y + j - center) + x - center;        \
+            for (int i = 0; i < kernel_size; i++) {                             \
+                sum += (float)in[i] * *k++;                                     \
+            }                                                                   \
+        }                                                                       \
+        out_row[x] = STORE(sum);                                                \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static void NAME##_edge(const image_view_t *src, const image_view_t *dst,       \
+                        const float *kernel, int kernel_size,                   \
+                        const border_t *border, int y, int x0, int x1) {        \
+    int center = kernel_size / 2;                                               \
+    T *out_row = (T *)VIEW_ROW(T, dst, y);                                      \
+                                                                                \
+    for (int x = x0; x < x1; x++) {                                             \
+        float sum = 0.0f;                                                       \
+                                                                                \
+        for (int j = 0; j < kernel_size; j++) {                                 \
+            int image_y = border_index(y + j - center, src->height, border->mode); \
+            const T *in_row = (image_y >= 0) ? VIEW_ROW(T, src, image_y) : NULL;\
+                                                                                \
+            for (int i = 0; i < kernel_size; i++) {                             \
+                int image_x = border_index(x + i - center, src->width, border->mode); \
+                T px = (in_row && image_x >= 0) ? in_row[image_x] : (T)border->value; \
+                sum += (float)px * kernel[j * kernel_size + i];                 \
+            }                                                                   \
+        }                                                                       \
+        out_row[x] = STORE(sum);                                                \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+void NAME##_border(const image_view_t *src, const image_view_t *dst,            \
+                   const float *kernel, int kernel_size, const border_t *border) { \
+    regions_t g = split_regions(src, kernel_size / 2, border);                  \
+    int height = src->height;                                                   \
+    int width = src->width;                                                     \
+                                                                                \
+    for (int y = 0; y < height; y++) {                                          \
+        if (y < g.pad || y >= height - g.pad) {                                 \
+            NAME##_edge(src, dst, kernel, kernel_size, border, y, 0, width);    \
+        } else {                                                                \
+            NAME##_edge(src, dst, kernel, kernel_size, border, y, 0, g.x0);     \
+            NAME##_interior(src, dst, kernel, kernel_size, y, g.x0, g.x1);      \
+            NAME##_edge(src, dst, kernel, kernel_size, border, y, g.x1, width); \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+void NAME(const image_view_t *src, const image_view_t *dst,                     \
+          const float *kernel, int kernel_size) {                               \
+    NAME##_border(src, dst, kernel, kernel_size, &border_replicate);            \
+}
+
+#define DEFINE_SORT_WINDOW(NAME, T)                                             \
+void NAME(T *window, int size) {                                                \
+    for (int i = 0; i < size - 1; i++) {                                        \
+        for (int j = 0; j < size - 1 - i; j++) {                                \
+            if (window[j] > window[j + 1]) {                                    \
+                /* Swap işlemi (yer değiştirme) */                              \
+                T temp = window[j];                                             \
+                window[j] = window[j + 1];                                      \
+                window[j + 1] = temp;                                           \
+            }                                                                   \
+        }                                                                       \
+    }                                                                           \
+}
+
+#define DEFINE_MEDIAN(NAME, T, SORT)                                            \
+static void NAME##_interior(const image_view_t *src, const image_view_t *dst,   \
+                            int kernel_size, int y, int x0, int x1) {           \
+    int center = kernel_size / 2;                                               \
+    int window_size = kernel_size * kernel_size;                                \
+    T *out_row = (T *)VIEW_ROW(T, dst, y);                                      \
+    T window[MEDIAN_MAX_WINDOW];                                                \
+                                                                                \
+    for (int x = x0; x < x1; x++) {                                             \
+        int window_idx = 0;                                                     \
+                                                                                \
+        for (int j = 0; j < kernel_size; j++) {                                 \
+            const T *in = VIEW_ROW(T, src, y + j - center) + x - center;        \
+            for (int i = 0; i < kernel_size; i++) {                             \
+                window[window_idx++] = in[i];                                   \
+            }                                                                   \
+        }                                                                       \
+        SORT(window, window_size);                                              \
+        out_row[x] = window[window_size / 2];                                   \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+static void NAME##_edge(const image_view_t *src, const image_view_t *dst,       \
+                        int kernel_size, const border_t *border,                \
+                        int y, int x0, int x1) {                                \
+    int center = kernel_size / 2;                                               \
+    int window_size = kernel_size * kernel_size;                                \
+    T *out_row = (T *)VIEW_ROW(T, dst, y);                                      \
+    T window[MEDIAN_MAX_WINDOW];                                                \
+                                                                                \
+    for (int x = x0; x < x1; x++) {                                             \
+        int window_idx = 0;                                                     \
+                                                                                \
+        for (int j = 0; j < kernel_size; j++) {                                 \
+            int image_y = border_index(y + j - center, src->height, border->mode); \
+            const T *in_row = (image_y >= 0) ? VIEW_ROW(T, src, image_y) : NULL;\
+                                                                                \
+            for (int i = 0; i < kernel_size; i++) {                             \
+                int image_x = border_index(x + i - center, src->width, border->mode); \
+                window[window_idx++] = (in_row && image_x >= 0) ? in_row[image_x] : (T)border->value; \
+            }                                                                   \
+        }                                                                       \
+        SORT(window, window_size);                                              \
+        out_row[x] = window[window_size / 2];                                   \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+void NAME##_border(const image_view_t *src, const image_view_t *dst,            \
+                   int kernel_size, const border_t *border) {                   \
+    regions_t g = split_regions(src, kernel_size / 2, border);                  \
+    int height = src->height;                                                   \
+    int width = src->width;                                                     \
+                                                                                \
+    for (int y = 0; y < height; y++) {                                          \
+        if (y < g.pad || y >= height - g.pad) {                                 \
+            NAME##_edge(src, dst, kernel_size, border, y, 0, width);            \
+        } else {                                                                \
+            NAME##_edge(src, dst, kernel_size, border, y, 0, g.x0);             \
+            NAME##_interior(src, dst, kernel_size, y, g.x0, g.x1);              \
+            NAME##_edge(src, dst, kernel_size, border, y, g.x1, width);         \
+        }                                                                       \
+    }                                                                           \
+}                                                                               \
+                                                                                \
+void NAME(const image_view_t *src, const image_view_t *dst,                     \
+          int kernel_size) {                                                    \
+    NAME##_border(src, dst, kernel_size, &border_replicate);                    \
+}
+
+DEFINE_CONVOLUTION(apply_2d_convolution,     uint8_t,  store_u8)
+DEFINE_CONVOLUTION(apply_2d_convolution_u16, uint16_t, store_u16)
+DEFINE_CONVOLUTION(apply_2d_convolution_f32, float,    store_f32)
+
+DEFINE_SORT_WINDOW(sort_window,     uint8_t)
+DEFINE_SORT_WINDOW(sort_window_u16, uint16_t)
+DEFINE_SORT_WINDOW(sort_window_f32, float)
+
+DEFINE_MEDIAN(apply_median_filtering,     uint8_t,  sort_window)
+DEFINE_MEDIAN(apply_median_filtering_u16, uint16_t, sort_window_u16)
+DEFINE_MEDIAN(apply_median_filtering_f32, float,    sort_window_f32)
+
+/*
+ * Box (mean) filter with running sums. col_sums[x] holds the sum of the
+ * kernel_size pixels of column x around the current row; it is updated by
+ * adding the row entering the window and removing the row leaving it. Each
+ * output then slides a row sum over col_sums the same way, so every pixel
+ * costs two additions, two subtractions and a division for any kernel size.
+ * The mean is rounded to nearest.
+ */
+void apply_box_filter(const image_view_t *src, const image_view_t *dst,
+                      int kernel_size, uint32_t *col_sums) {
+
+    int r = kernel_size / 2;
+    int height = src->height;
+    int width = src->width;
+    uint32_t area = (uint32_t)kernel_size * kernel_size;
+
+    for (int x = 0; x < width; x++) col_sums[x] = 0;
+    for (int j = -r; j <= r; j++) {
+        const uint8_t *in_row = IMAGE_VIEW_ROW_U8(src, clamp_index(j, height));
+        for (int x = 0; x < width; x++) col_sums[x] += in_row[x];
+    }
+
+    for (int y = 0; y < height; y++) {
+        uint8_t *out_row = IMAGE_VIEW_ROW_U8(dst, y);
+        uint32_t sum = 0;
+
+        for (int i = -r; i <= r; i++) sum += col_sums[clamp_index(i, width)];
+        out_row[0] = (uint8_t)((sum + area / 2) / area);
+
+        for (int x = 1; x < width; x++) {
+            sum += col_sums[clamp_index(x + r, width)];
+            sum -= col_sums[clamp_index(x - 1 - r, width)];
+            out_row[x] = (uint8_t)((sum + area / 2) / area);
+        }
+
+        if (y + 1 < height) {
+            const uint8_t *enter = IMAGE_VIEW_ROW_U8(src, clamp_index(y + 1 + r, height));
+            const uint8_t *leave = IMAGE_VIEW_ROW_U8(src, clamp_index(y - r, height));
+            for (int x = 0; x < width; x++) col_sums[x] += enter[x] - leave[x];
+        }
+    }
+}
+
+static inline uint8_t store_combination(const box_combination_t *c, uint8_t center, uint32_t sum)
+{
+    int32_t n = c->center_weight * (int32_t)center + c->sum_weight * (int32_t)sum;
+
+    if (n <= 0) return 0;
+    n = (n + c->divisor / 2) / c->divisor;
+    return (n > 255) ? 255 : (uint8_t)n;
+}
+
+/*
+ * Same running sums as apply_box_filter(); each box sum is read once and
+ * every requested combination is stored from it.
+ */
+void apply_box_filter_bank(const image_view_t *src, const image_view_t *const *dsts,
+                           const box_combination_t *combinations, int count,
+                           int kernel_size, uint32_t *col_sums) {
+
+    int r = kernel_size / 2;
+    int height = src->height;
+    int width = src->width;
+
+    for (int x = 0; x < width; x++) col_sums[x] = 0;
+    for (int j = -r; j <= r; j++) {
+        const uint8_t *in_row = IMAGE_VIEW_ROW_U8(src, clamp_index(j, height));
+        for (int x = 0; x < width; x++) col_sums[x] += in_row[x];
+    }
+
+    for (int y = 0; y < height; y++) {
+        const uint8_t *center = IMAGE_VIEW_ROW_U8(src, y);
+        uint8_t *out_rows[BOX_BANK_MAX_OUTPUTS];
+        uint32_t sum = 0;
+
+        for (int n = 0; n < count; n++) out_rows[n] = IMAGE_VIEW_ROW_U8(dsts[n], y);
+
+        for (int i = -r; i <= r; i++) sum += col_sums[clamp_index(i, width)];
+        for (int x = 0; x < width; x++) {
+            if (x > 0) {
+                sum += col_sums[clamp_index(x + r, width)];
+                sum -= col_sums[clamp_index(x - 1 - r, width)];
+            }
+            for (int n = 0; n < count; n++) {
+                out_rows[n][x] = store_combination(&combinations[n], center[x], sum);
+            }
+        }
+
+        if (y + 1 < height) {
+            const uint8_t *enter = IMAGE_VIEW_ROW_U8(src, clamp_index(y + 1 + r, height));
+            const uint8_t *leave = IMAGE_VIEW_ROW_U8(src, clamp_index(y - r, height));
+            for (int x = 0; x < width; x++) col_sums[x] += enter[x] - leave[x];
+        }
+    }
+}
+
+/*
+ * Constant-time median (Perreault & Hebert). Every column keeps a histogram
+ * of its kernel_size pixels around the current row, split into 16 coarse
+ * bins (the high nibble) and 256 fine bins. Sliding along a row adds the
+ * entering column's coarse histogram to the kernel's and subtracts the
+ * leaving one's, which is 16 additions and 16 subtractions per pixel. Once
+ * the coarse bin holding the median is found, only that bin's 16 fine
+ * counts are brought up to date, from the columns that moved since it was
+ * last used. Column counts are at most kernel_size, so they fit in a byte.
+ */
+#define CT_COARSE 16
+#define CT_FINE   256
+
+static inline void column_add(uint8_t *coarse, uint8_t *fine, uint8_t v)
+{
+    coarse[v >> 4]++;
+    fine[v]++;
+}
+
+static inline void column_remove(uint8_t *coarse, uint8_t *fine, uint8_t v)
+{
+    coarse[v >> 4]--;
+    fine[v]--;
+}
+
+void apply_median_filtering_ct(const image_view_t *src, const image_view_t *dst,
+                               int kernel_size, uint8_t *workspace) {
+
+    int r = kernel_size / 2;
+    int height = src->height;
+    int width = src->width;
+    uint32_t rank = (uint32_t)kernel_size * kernel_size / 2;
+    uint8_t *col_coarse = workspace;
+    uint8_t *col_fine = workspace + (uint32_t)width * CT_COARSE;
+
+    memset(workspace, 0, MEDIAN_CT_WORKSPACE_SIZE(width));
+    for (int j = -r; j <= r; j++) {
+        const uint8_t *in_row = IMAGE_VIEW_ROW_U8(src, clamp_index(j, height));
+        for (int x = 0; x < width; x++) {
+            column_add(&col_coarse[x * CT_COARSE], &col_fine[x * CT_FINE], in_row[x]);
+        }
+    }
+
+    for (int y = 0; y < height; y++) {
+        uint8_t *out_row = IMAGE_VIEW_ROW_U8(dst, y);
+        uint16_t coarse[CT_COARSE] = {0};
+        uint16_t fine[CT_COARSE][CT_COARSE];
+        int fine_x[CT_COARSE];   // x at which fine[b] was last brought up to date
+
+        for (int i = -r; i <= r; i++) {
+            const uint8_t *c = &col_coarse[clamp_index(i, width) * CT_COARSE];
+            for (int b = 0; b < CT_COARSE; b++) coarse[b] += c[b];
+        }
+        for (int b = 0; b < CT_COARSE; b++) fine_x[b] = INT32_MIN / 2;
+
+        for (int x = 0; x < width; x++) {
+            if (x > 0) {
+                const uint8_t *enter = &col_coarse[clamp_index(x + r, width) * CT_COARSE];
+                const uint8_t *leave = &col_coarse[clamp_index(x - r - 1, width) * CT_COARSE];
+                for (int b = 0; b < CT_COARSE; b++) coarse[b] += enter[b] - leave[b];
+            }
+
+            // Coarse bin holding the rank-th smallest value
+            uint32_t count = 0;
+            int b = 0;
+            while (count + coarse[b] <= rank) count += coarse[b++];
+
+            // Bring fine[b] to column x, or rebuild it if it is too far behind
+            uint16_t *f = fine[b];
+            if (x - fine_x[b] > 2 * r) {
+                for (int v = 0; v < CT_COARSE; v++) f[v] = 0;
+                for (int i = -r; i <= r; i++) {
+                    const uint8_t *c = &col_fine[clamp_index(x + i, width) * CT_FINE + b * CT_COARSE];
+                    for (int v = 0; v < CT_COARSE; v++) f[v] += c[v];
+                }
+            } else {
+                for (int xx = fine_x[b] + 1; xx <= x; xx++) {
+                    const uint8_t *enter = &col_fine[clamp_index(xx + r, width) * CT_FINE + b * CT_COARSE];
+                    const uint8_t *leave = &col_fine[clamp_index(xx - r - 1, width) * CT_FINE + b * CT_COARSE];
+                    for (int v = 0; v < CT_COARSE; v++) f[v] += enter[v] - leave[v];
+                }
+            }
+            fine_x[b] = x;
+
+            int v = 0;
+            while (count + f[v] <= rank) count += f[v++];
+            out_row[x] = (uint8_t)(b * CT_COARSE + v);
+        }
+
+        if (y + 1 < height) {
+            const uint8_t *enter = IMAGE_VIEW_ROW_U8(src, clamp_index(y + 1 + r, height));
+            const uint8_t *leave = IMAGE_VIEW_ROW_U8(src, clamp_index(y - r, height));
+            for (int x = 0; x < width; x++) {
+                column_remove(&col_coarse[x * CT_COARSE], &col_fine[x * CT_FINE], leave[x]);
+                column_add(&col_coarse[x * CT_COARSE], &col_fine[x * CT_FINE], enter[x]);
+            }
+        }
+    }
+}
@@ -0,0 +1,151 @@
+/*
+ * spatial_filters_simd.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "spatial_filters.h"
+
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+#include <arm_acle.h>
+#endif
+
+#define BYTES_0x80 0x80808080u
+
+static inline uint32_t load_word(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, 4);
+    return w;
+}
+
+static inline void store_word(uint8_t *p, uint32_t w)
+{
+    memcpy(p, &w, 4);
+}
+
+/*
+ * Byte-wise min and max of 4 pixels at once. On the Cortex-M4, USUB8 sets
+ * a GE flag for every byte where a >= b and SEL picks bytes by those flags.
+ * Elsewhere, the same a >= b mask comes from the SWAR compare used by the
+ * HW1 threshold.
+ */
+static inline void minmax4(uint32_t *a, uint32_t *b)
+{
+#if defined(__ARM_FEATURE_SIMD32) && __ARM_FEATURE_SIMD32
+    (void)__usub8(*a, *b);
+    uint32_t lo = __sel(*b, *a);
+    uint32_t hi = __sel(*a, *b);
+#else
+    uint32_t z = (*a | BYTES_0x80) - (*b & ~BYTES_0x80);
+    uint32_t ge = ((*a & ~*b) | (~(*a ^ *b) & z)) & BYTES_0x80;
+    uint32_t mask = (ge >> 7) * 0xFFu;
+    uint32_t lo = (*b & mask) | (*a & ~mask);
+    uint32_t hi = (*a & mask) | (*b & ~mask);
+#endif
+    *a = lo;
+    *b = hi;
+}
+
+static inline void minmax1(uint8_t *a, uint8_t *b)
+{
+    uint8_t lo = (*a < *b) ? *a : *b;
+    uint8_t hi = (*a < *b) ? *b : *a;
+    *a = lo;
+    *b = hi;
+}
+
+/*
+ * 3x3 median from sorted columns: with every column sorted into lo <= mid
+ * <= hi, the median of the 9 pixels is
+ *     med3(max(lo[x-1], lo[x], lo[x+1]),
+ *          med3(mid[x-1], mid[x], mid[x+1]),
+ *          min(hi[x-1], hi[x], hi[x+1])).
+ * Each column is sorted once per row, three compare-exchanges, and shared by
+ * the three outputs that use it; each output then takes 10 more. Both steps
+ * handle 4 pixels per 32-bit word.
+ *
+ * line_buf holds the sorted lo, mid and hi rows, each with a replicated
+ * column on either side.
+ */
+void median3_row(const uint8_t *r0, const uint8_t *r1, const uint8_t *r2,
+                 uint8_t *out, int width, uint8_t *line_buf)
+{
+    uint8_t *lo = line_buf;
+    uint8_t *mid = lo + width + 2;
+    uint8_t *hi = mid + width + 2;
+    int x = 0;
+
+    // Sort every column of rows y - 1, y, y + 1
+    for (; x + 4 <= width; x += 4) {
+        uint32_t a = load_word(&r0[x]), b = load_word(&r1[x]), c = load_word(&r2[x]);
+        minmax4(&a, &b);
+        minmax4(&b, &c);
+        minmax4(&a, &b);
+        store_word(&lo[x + 1], a);
+        store_word(&mid[x + 1], b);
+        store_word(&hi[x + 1], c);
+    }
+    for (; x < width; x++) {
+        uint8_t a = r0[x], b = r1[x], c = r2[x];
+        minmax1(&a, &b);
+        minmax1(&b, &c);
+        minmax1(&a, &b);
+        lo[x + 1] = a;
+        mid[x + 1] = b;
+        hi[x + 1] = c;
+    }
+    lo[0] = lo[1];    lo[width + 1] = lo[width];
+    mid[0] = mid[1];  mid[width + 1] = mid[width];
+    hi[0] = hi[1];    hi[width + 1] = hi[width];
+
+    // Combine columns x - 1, x, x + 1 (buffer entries x, x + 1, x + 2)
+    for (x = 0; x + 4 <= width; x += 4) {
+        uint32_t l0 = load_word(&lo[x]), l1 = load_word(&lo[x + 1]), l2 = load_word(&lo[x + 2]);
+        uint32_t m0 = load_word(&mid[x]), m1 = load_word(&mid[x + 1]), m2 = load_word(&mid[x + 2]);
+        uint32_t h0 = load_word(&hi[x]), h1 = load_word(&hi[x + 1]), h2 = load_word(&hi[x + 2]);
+
+        minmax4(&l0, &l1);      // l1 = max(l0, l1)
+        minmax4(&l1, &l2);      // l2 = max of the lows
+        minmax4(&h0, &h1);      // h0 = min(h0, h1)
+        minmax4(&h0, &h2);      // h0 = min of the highs
+        minmax4(&m0, &m1);
+        minmax4(&m1, &m2);
+        minmax4(&m0, &m1);      // m1 = median of the mids
+        minmax4(&l2, &m1);
+        minmax4(&m1, &h0);
+        minmax4(&l2, &m1);      // m1 = median of the three
+        store_word(&out[x], m1);
+    }
+    for (; x < width; x++) {
+        uint8_t l0 = lo[x], l1 = lo[x + 1], l2 = lo[x + 2];
+        uint8_t m0 = mid[x], m1 = mid[x + 1], m2 = mid[x + 2];
+        uint8_t h0 = hi[x], h1 = hi[x + 1], h2 = hi[x + 2];
+
+        minmax1(&l0, &l1);
+        minmax1(&l1, &l2);
+        minmax1(&h0, &h1);
+        minmax1(&h0, &h2);
+        minmax1(&m0, &m1);
+        minmax1(&m1, &m2);
+        minmax1(&m0, &m1);
+        minmax1(&l2, &m1);
+        minmax1(&m1, &h0);
+        minmax1(&l2, &m1);
+        out[x] = m1;
+    }
+}
+
+void apply_median3(const image_view_t *src, const image_view_t *dst, uint8_t *line_buf)
+{
+    int height = src->height;
+
+    for (int y = 0; y < height; y++) {
+        median3_row(IMAGE_VIEW_ROW_U8(src, (y > 0) ? y - 1 : 0),
+                    IMAGE_VIEW_ROW_U8(src, y),
+                    IMAGE_VIEW_ROW_U8(src, (y + 1 < height) ? y + 1 : height - 1),
+                    IMAGE_VIEW_ROW_U8(dst, y), src->width, line_buf);
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * stream_pipeline.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include "stream_pipeline.h"
+#include "pixel_math.h"
+
+// Taps in the order of apply_2d_convolution(), so the float sums match it
+static void conv3_row(const uint8_t *const rows[STREAM_KERNEL_SIZE], const float *kernel,
+                      uint8_t *out, int width)
+{
+    for (int x = 0; x < width; x++) {
+        float sum = 0.0f;
+        const float *k = kernel;
+
+        for (int j = 0; j < STREAM_KERNEL_SIZE; j++) {
+            for (int i = 0; i < STREAM_KERNEL_SIZE; i++) {
+                sum += (float)rows[j][clamp_index(x + i - 1, width)] * *k++;
+            }
+        }
+        out[x] = store_u8(sum);
+    }
+}
+
+// Emits the 3x3 results for row y; rows y - 1 .. y + 1 are in the ring
+static void emit_neighbourhood(const stream_pipeline_t *p, uint8_t *ring, uint8_t *out,
+                               uint8_t *median_buf, uint32_t y)
+{
+    int width = p->width;
+    const uint8_t *rows[STREAM_KERNEL_SIZE];
+
+    rows[0] = &ring[((y > 0 ? y - 1 : 0) % STREAM_KERNEL_SIZE) * width];
+    rows[1] = &ring[(y % STREAM_KERNEL_SIZE) * width];
+    rows[2] = &ring[((y + 1 < p->height ? y + 1 : y) % STREAM_KERNEL_SIZE) * width];
+
+    if (p->outputs & STREAM_LOW_PASS) {
+        conv3_row(rows, p->low_pass_kernel, out, width);
+        p->sink(p->sink_ctx, STREAM_LOW_PASS, y, out, p->width);
+    }
+    if (p->outputs & STREAM_HIGH_PASS) {
+        conv3_row(rows, p->high_pass_kernel, out, width);
+        p->sink(p->sink_ctx, STREAM_HIGH_PASS, y, out, p->width);
+    }
+    if (p->outputs & STREAM_MEDIAN) {
+        median3_row(rows[0], rows[1], rows[2], out, width, median_buf);
+        p->sink(p->sink_ctx, STREAM_MEDIAN, y, out, p->width);
+    }
+}
+
+int stream_pipeline_run(const stream_pipeline_t *p, uint8_t *buffer)
+{
+    int width = p->width;
+    uint8_t *ring = buffer;
+    uint8_t *out = ring + STREAM_KERNEL_SIZE * width;
+    uint8_t *median_buf = out + width;
+    const uint32_t neighbourhood = STREAM_LOW_PASS | STREAM_HIGH_PASS | STREAM_MEDIAN;
+
+    for (uint32_t y = 0; y < p->height; y++) {
+        uint8_t *row = &ring[(y % STREAM_KERNEL_SIZE) * width];
+
+        if (p->source(p->source_ctx, y, row, p->width) != 0) return -1;
+
+        if (p->histogram) {
+            for (int x = 0; x < width; x++) p->histogram[row[x]]++;
+        }
+        if (p->eq_lut) {
+            for (int x = 0; x < width; x++) row[x] = p->eq_lut[row[x]];
+        }
+        if (p->outputs & STREAM_EQUALIZED) {
+            p->sink(p->sink_ctx, STREAM_EQUALIZED, y, row, p->width);
+        }
+
+        // Row y - 1 now has both neighbours
+        if (y > 0 && (p->outputs & neighbourhood)) {
+            emit_neighbourhood(p, ring, out, median_buf, y - 1);
+        }
+    }
+
+    // The last row is its own lower neighbour
+    if (p->height > 0 && (p->outputs & neighbourhood)) {
+        emit_neighbourhood(p, ring, out, median_buf, p->height - 1);
+    }
+    return 0;
+}
@@ -5,25 +5,64 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
+../Core/Src/clahe.c \
+../Core/Src/conv_plan.c \
+../Core/Src/conv_q15.c \
+../Core/Src/equalization.c \
+../Core/Src/filter_graph.c \
+../Core/Src/histogram.c \
+../Core/Src/image_codec.c \
 ../Core/Src/main.c \
+../Core/Src/pipeline.c \
+../Core/Src/real_fft.c \
+../Core/Src/row_transport.c \
+../Core/Src/spatial_filters.c \
+../Core/Src/spatial_filters_simd.c \
 ../Core/Src/stm32f4xx_hal_msp.c \
 ../Core/Src/stm32f4xx_it.c \
+../Core/Src/stream_pipeline.c \
 ../Core/Src/syscalls.c \
 ../Core/Src/sysmem.c \
 ../Core/Src/system_stm32f4xx.c 
 
 OBJS += \
+./Core/Src/clahe.o \
+./Core/Src/conv_plan.o \
+./Core/Src/conv_q15.o \
+./Core/Src/equalization.o \
+./Core/Src/filter_graph.o \
+./Core/Src/histogram.o \
+./Core/Src/image_codec.o \
 ./Core/Src/main.o \
+./Core/Src/pipeline.o \
+./Core/Src/real_fft.o \
+./Core/Src/row_transport.o \
+./Core/Src/spatial_filters.o \
+./Core/Src/spatial_filters_simd.o \
 ./Core/Src/stm32f4xx_hal_msp.o \
 ./Core/Src/stm32f4xx_it.o \
+./Core/Src/stream_pipeline.o \
 ./Core/Src/syscalls.o \
 ./Core/Src/sysmem.o \
 ./Core/Src/system_stm32f4xx.o 
 
 C_DEPS += \
+./Core/Src/clahe.d \
+./Core/Src/conv_plan.d \
+./Core/Src/conv_q15.d \
+./Core/Src/equalization.d \
+./Core/Src/filter_graph.d \
+./Core/Src/histogram.d \
+./Core/Src/image_codec.d \
 ./Core/Src/main.d \
+./Core/Src/pipeline.d \
+./Core/Src/real_fft.d \
+./Core/Src/row_transport.d \
+./Core/Src/spatial_filters.d \
+./Core/Src/spatial_filters_simd.d \
 ./Core/Src/stm32f4xx_hal_msp.d \
 ./Core/Src/stm32f4xx_it.d \
+./Core/Src/stream_pipeline.d \
 ./Core/Src/syscalls.d \
 ./Core/Src/sysmem.d \
 ./Core/Src/system_stm32f4xx.d 
@@ -36,7 +75,7 @@ Core/Src/%.o Core/Src/%.su Core/Src/%.cyclo: ../Core/Src/%.c Core/Src/subdir.mk
 clean: clean-Core-2f-Src
 
 clean-Core-2f-Src:
-	-$(RM) ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su
+	-$(RM) ./Core/Src/clahe.cyclo ./Core/Src/clahe.d ./Core/Src/clahe.o ./Core/Src/clahe.su ./Core/Src/conv_plan.cyclo ./Core/Src/conv_plan.d ./Core/Src/conv_plan.o ./Core/Src/conv_plan.su ./Core/Src/conv_q15.cyclo ./Core/Src/conv_q15.d ./Core/Src/conv_q15.o ./Core/Src/conv_q15.su ./Core/Src/equalization.cyclo ./Core/Src/equalization.d ./Core/Src/equalization.o ./Core/Src/equalization.su ./Core/Src/filter_graph.cyclo ./Core/Src/filter_graph.d ./Core/Src/filter_graph.o ./Core/Src/filter_graph.su ./Core/Src/histogram.cyclo ./Core/Src/histogram.d ./Core/Src/histogram.o ./Core/Src/histogram.su ./Core/Src/image_codec.cyclo ./Core/Src/image_codec.d ./Core/Src/image_codec.o ./Core/Src/image_codec.su ./Core/Src/main.cyclo ./Core/Src/main.d ./Core/Src/main.o ./Core/Src/main.su ./Core/Src/pipeline.cyclo ./Core/Src/pipeline.d ./Core/Src/pipeline.o ./Core/Src/pipeline.su ./Core/Src/real_fft.cyclo ./Core/Src/real_fft.d ./Core/Src/real_fft.o ./Core/Src/real_fft.su ./Core/Src/row_transport.cyclo ./Core/Src/row_transport.d ./Core/Src/row_transport.o ./Core/Src/row_transport.su ./Core/Src/spatial_filters.cyclo ./Core/Src/spatial_filters.d ./Core/Src/spatial_filters.o ./Core/Src/spatial_filters.su ./Core/Src/spatial_filters_simd.cyclo ./Core/Src/spatial_filters_simd.d ./Core/Src/spatial_filters_simd.o ./Core/Src/spatial_filters_simd.su ./Core/Src/stm32f4xx_hal_msp.cyclo ./Core/Src/stm32f4xx_hal_msp.d ./Core/Src/stm32f4xx_hal_msp.o ./Core/Src/stm32f4xx_hal_msp.su ./Core/Src/stm32f4xx_it.cyclo ./Core/Src/stm32f4xx_it.d ./Core/Src/stm32f4xx_it.o ./Core/Src/stm32f4xx_it.su ./Core/Src/stream_pipeline.cyclo ./Core/Src/stream_pipeline.d ./Core/Src/stream_pipeline.o ./Core/Src/stream_pipeline.su ./Core/Src/syscalls.cyclo ./Core/Src/syscalls.d ./Core/Src/syscalls.o ./Core/Src/syscalls.su ./Core/Src/sysmem.cyclo ./Core/Src/sysmem.d ./Core/Src/sysmem.o ./Core/Src/sysmem.su ./Core/Src/system_stm32f4xx.cyclo ./Core/Src/system_stm32f4xx.d ./Core/Src/system_stm32f4xx.o ./Core/Src/system_stm32f4xx.su
 
 .PHONY: clean-Core-2f-Src
 
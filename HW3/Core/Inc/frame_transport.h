@@ -0,0 +1,115 @@
+/*
+ * frame_transport.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef FRAME_TRANSPORT_H_
+#define FRAME_TRANSPORT_H_
+
+#include <stdint.h>
+
+/* Çift tamponlu kare taşıma. İki yuva sırayla kullanılır: kare N+1 bir
+ * yuvaya alınırken kare N diğerinde işlenir ve ardından aynı yuvadan
+ * gönderilir. Alma, gönderme bitip yuva boşalır boşalmaz devam eder; UART
+ * boşta beklemez, CPU da sadece işleme süresi kadar meşgul olur.
+ *
+ * Donanıma dokunmaz: alma/gönderme başlatma, kesme kilidi ve bekleme
+ * frame_port_t üzerinden yapılır. Kartta HAL DMA (main.c), Linux'ta
+ * sahte terminal üzerinde thread'ler (host/uart_pty_port.c) kullanılır.
+ * frame_transport_rx_complete(), _tx_complete() ve _error() kesmeden
+ * çağrılır; diğerleri ana döngüden.
+ *
+ * Başlatılamayan alma/gönderme kaybolmaz: gönderilecek yuva DONE'da, alma
+ * rx_retry ile bekler ve frame_transport_wait() ikisini yeniden dener.
+ * Ana döngü, işlenecek kare yoksa wait()'i çağırır. */
+#define FRAME_SLOTS       2
+#define FRAME_HEADER_MAX  4
+
+/* frame_transport_error(): hata ile duran yönler */
+#define FRAME_ERROR_RX    0x1u
+#define FRAME_ERROR_TX    0x2u
+
+typedef struct {
+    int (*start_receive)(void *ctx, uint8_t *buf, uint32_t size);          // 0: başladı
+    int (*start_transmit)(void *ctx, const uint8_t *buf, uint32_t size);
+    void (*lock)(void *ctx);      // kesmeleri kapat (kart) / mutex (host)
+    void (*unlock)(void *ctx);
+    void (*wait)(void *ctx);      // kilit altında çağrılır: olay gelene kadar uyu (__WFI)
+    void *ctx;
+} frame_port_t;
+
+typedef enum {
+    SLOT_FREE,
+    SLOT_RECEIVING,
+    SLOT_READY,         // alındı, işlenmeyi bekliyor
+    SLOT_PROCESSING,
+    SLOT_DONE,          // işlendi, göndermeyi bekliyor
+    SLOT_SENDING
+} frame_slot_state_t;
+
+typedef struct {
+    uint8_t *data;
+    uint8_t header[FRAME_HEADER_MAX];
+    uint32_t out_offset;
+    uint32_t out_size;
+    volatile frame_slot_state_t state;
+} frame_slot_t;
+
+/* Başlıktan sonra gelecek veri boyutu; 0 ise başlık atlanır */
+typedef uint32_t (*frame_payload_size_t)(const uint8_t *header);
+
+typedef struct {
+    const frame_port_t *port;
+    frame_payload_size_t payload_size;
+    uint32_t header_size;
+    uint32_t slot_size;
+    frame_slot_t slots[FRAME_SLOTS];
+    // Kareler yuvalara sırayla girer, aynı sırayla işlenir ve gönderilir
+    uint8_t rx_slot;
+    uint8_t process_slot;
+    uint8_t tx_slot;
+    volatile uint8_t rx_payload;    // 0: başlık, 1: veri alınıyor
+    volatile uint8_t rx_stalled;    // sıradaki yuva dolu; gönderimi bitince alma sürer
+    volatile uint8_t tx_busy;
+    volatile uint8_t rx_retry;      // başlık alma başlatılamadı; wait() yeniden dener
+    // İstatistik
+    volatile uint32_t frames_received;
+    volatile uint32_t frames_sent;
+    volatile uint32_t rx_stalls;
+    volatile uint32_t skipped_headers;
+    volatile uint32_t errors;
+} frame_transport_t;
+
+/* buffers: FRAME_SLOTS adet, her biri slot_size byte */
+void frame_transport_init(frame_transport_t *t, const frame_port_t *port,
+                          frame_payload_size_t payload_size, uint32_t header_size,
+                          uint8_t *const *buffers, uint32_t slot_size);
+
+/* İlk başlığın alınmasını başlatır */
+void frame_transport_start(frame_transport_t *t);
+
+/* İşlenecek sıradaki kare, yoksa NULL */
+frame_slot_t *frame_transport_next(frame_transport_t *t);
+
+/* Kare işlendi: data[out_offset, out_offset + out_size) gönderilir. out_size 0
+ * ise cevap yoktur ve yuva hemen boşalır. */
+void frame_transport_submit(frame_transport_t *t, frame_slot_t *slot,
+                            uint32_t out_offset, uint32_t out_size);
+
+/* Başlatılamamış alma ve gönderimi yeniden dener, sonra işlenecek kare yoksa
+ * port wait() ile uyur. Kontrol ve uyku aynı kilit altındadır: aradaki bir
+ * alma kesmesi kaybolmaz, kartta __WFI() bekleyen kesmeyle hemen uyanır ve
+ * kesme kilit açılınca çalışır. Ana döngüden, next() NULL döndüğünde. */
+void frame_transport_wait(frame_transport_t *t);
+
+/* Kesme tarafı: alma/gönderme bitti, ya da hata. stopped, hatada duran
+ * yönlerdir (FRAME_ERROR_*). Duran almada kare atılır ve sıradaki başlık
+ * beklenir; duran gönderimde yuva DONE'a döner ve cevap wait() ile baştan
+ * gönderilir. */
+void frame_transport_rx_complete(frame_transport_t *t);
+void frame_transport_tx_complete(frame_transport_t *t);
+void frame_transport_error(frame_transport_t *t, uint32_t stopped);
+
+#endif /* FRAME_TRANSPORT_H_ */
@@ -0,0 +1,81 @@
+/*
+ * image_view.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef IMAGE_VIEW_H_
+#define IMAGE_VIEW_H_
+
+#include <stdint.h>
+
+/*
+ * A view describes pixels in memory without owning them: the first pixel,
+ * the size in pixels and the distance between rows in bytes. A region of
+ * interest is a view into a larger buffer with the parent's stride, so
+ * kernels can work on a sub-window without copying it.
+ * Kernels treat the view's edges as the image edges.
+ */
+typedef enum {
+	PIXEL_U8,
+	PIXEL_U16,    // 12-bit sensor data in a 16-bit container
+	PIXEL_F32
+} pixel_type_t;
+
+#define PIXEL_U16_BITS 12
+#define PIXEL_U16_MAX  ((1u << PIXEL_U16_BITS) - 1)
+
+// Pixel type of a buffer, resolved at compile time from its pointer type
+#define PIXEL_TYPE_OF(p) _Generic((p), \
+	uint8_t *: PIXEL_U8, const uint8_t *: PIXEL_U8, \
+	uint16_t *: PIXEL_U16, const uint16_t *: PIXEL_U16, \
+	float *: PIXEL_F32, const float *: PIXEL_F32)
+
+typedef struct {
+	void *data;           // first pixel of the view
+	uint16_t width;
+	uint16_t height;
+	uint32_t stride;      // bytes from one row to the next
+	pixel_type_t type;
+} image_view_t;
+
+static inline uint32_t pixel_size(pixel_type_t type)
+{
+	return (type == PIXEL_U8) ? 1u : (type == PIXEL_U16) ? 2u : 4u;
+}
+
+// View over a whole, tightly packed width x height buffer
+static inline image_view_t image_view_make(const void *data, uint16_t width, uint16_t height, pixel_type_t type)
+{
+	image_view_t v = { (void *)data, width, height, (uint32_t)width * pixel_size(type), type };
+	return v;
+}
+
+// Sub-window of `parent`, clipped to the parent's bounds
+static inline image_view_t image_view_roi(const image_view_t *parent, uint16_t x, uint16_t y, uint16_t width, uint16_t height)
+{
+	image_view_t v = *parent;
+	if(x > parent->width) x = parent->width;
+	if(y > parent->height) y = parent->height;
+	if(width > parent->width - x) width = parent->width - x;
+	if(height > parent->height - y) height = parent->height - y;
+	v.data = (uint8_t *)parent->data + (uint32_t)y * parent->stride + (uint32_t)x * pixel_size(parent->type);
+	v.width = width;
+	v.height = height;
+	return v;
+}
+
+static inline void *image_view_row(const image_view_t *v, uint32_t y)
+{
+	return (uint8_t *)v->data + y * v->stride;
+}
+
+// View over a packed buffer whose pixel type follows from the pointer
+#define IMAGE_VIEW_OF(p, width, height)  image_view_make((p), (width), (height), PIXEL_TYPE_OF(p))
+
+#define IMAGE_VIEW_ROW_U8(v, y)   ((uint8_t *)image_view_row((v), (y)))
+#define IMAGE_VIEW_ROW_U16(v, y)  ((uint16_t *)image_view_row((v), (y)))
+#define IMAGE_VIEW_ROW_F32(v, y)  ((float *)image_view_row((v), (y)))
+
+#endif /* IMAGE_VIEW_H_ */
@@ -0,0 +1,34 @@
+/*
+ * mode_server.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef MODE_SERVER_H_
+#define MODE_SERVER_H_
+
+#include <stdint.h>
+
+#define IMG_WIDTH  128
+#define IMG_HEIGHT 128
+#define IMG_SIZE   (IMG_WIDTH * IMG_HEIGHT)
+
+/* PC'nin gönderdiği başlık: [Mode, Unused], ardından moda göre veri:
+ *   1, 3, 4: 8-bit gri (16KB)   2: R, G, B düzlemleri (48KB)
+ *   5: 12-bit little-endian uint16_t (32KB)
+ * Her kare kendi yuvasında işlenir; yuva en büyük veriyi (mod 2) alır ve 4
+ * byte hizalı olmalıdır. Cevap da yuvanın içinde üretilir:
+ *   1, 2: yerinde ikili görüntü      3, 4: IMG_SIZE ofsetinde morfoloji sonucu
+ *   5: başta 8-bit ikili görüntü, 12-bit histogram [2 * IMG_SIZE, 3 * IMG_SIZE)
+ * HAL'a bağlı değildir, host tarafında da derlenir (host/). */
+#define MODE_HEADER_SIZE 2
+#define MODE_SLOT_SIZE   (IMG_SIZE * 3)
+
+/* Başlıktan sonra gelecek veri boyutu; bilinmeyen modda 0 (başlık atlanır) */
+uint32_t mode_payload_size(const uint8_t *header);
+
+/* Yuvadaki kareyi işler; cevabın boyutunu döndürür, başlangıcını *out_offset'e yazar */
+uint32_t mode_process(uint8_t mode, uint8_t *slot, uint32_t *out_offset);
+
+#endif /* MODE_SERVER_H_ */
@@ -0,0 +1,20 @@
+/*
+ * morphology.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef MORPHOLOGY_H_
+#define MORPHOLOGY_H_
+
+#include <stdint.h>
+#include "image_view.h"
+
+/* 3x3 kare yapı elemanı ile ikili (0/255) morfoloji. Sadece view'ın iç
+ * pikselleri yazılır; kenar pikselleri hedefte olduğu gibi kalır.
+ * HAL'a bağlı değildir, host tarafında da derlenir (host/). */
+void morph_dilation(const image_view_t *src, const image_view_t *dst);
+void morph_erosion(const image_view_t *src, const image_view_t *dst);
+
+#endif /* MORPHOLOGY_H_ */
@@ -0,0 +1,34 @@
+/*
+ * segmentation.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef SEGMENTATION_H_
+#define SEGMENTATION_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "histogram.h"
+
+/* Otsu eşiği, her piksel tipi için. hist çağıranın tamponudur: 8-bit için
+ * OTSU_HIST_WORDS_8 eleman (histogram ve histogram_u8()'in üç alt
+ * histogramı, 4KB), 12-bit ve float için OTSU_BINS_12 eleman (16KB). Böylece
+ * büyük histogram, kare tamponunun boş kalan kısmında tutulabilir ve
+ * fonksiyonlar yeniden girilebilir kalır.
+ * HAL'a bağlı değildir, host tarafında da derlenir (host/). */
+#define OTSU_BINS_8  256
+#define OTSU_BINS_12 (PIXEL_U16_MAX + 1)
+#define OTSU_HIST_WORDS_8 (OTSU_BINS_8 + HISTOGRAM_SUB_WORDS)
+
+uint8_t compute_otsu(const image_view_t *v, uint32_t *hist);
+uint16_t compute_otsu_u16(const image_view_t *v, uint32_t *hist);
+float compute_otsu_f32(const image_view_t *v, uint32_t *hist);
+
+/* Sıfır olmayan piksellerin sınır kutusu {x, y, w, h}, her yönde margin kadar
+ * genişletilir (view dışına taşan kısım image_view_roi'de kırpılır).
+ * Görüntü boşsa w = h = 0 olur. */
+void foreground_bbox(const image_view_t *v, uint16_t margin, uint16_t box[4]);
+
+#endif /* SEGMENTATION_H_ */
@@ -0,0 +1,169 @@
+/*
+ * frame_transport.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stddef.h>
+#include "frame_transport.h"
+
+/* Aşağıdaki yardımcılar kilit altında (ya da kesmede) çağrılır */
+
+/* Başlatılamazsa yuva RECEIVING'de kalır, wait() yeniden dener */
+static void receive_header(frame_transport_t *t) {
+    frame_slot_t *s = &t->slots[t->rx_slot];
+    t->rx_payload = 0;
+    t->rx_retry = 0;
+    if (t->port->start_receive(t->port->ctx, s->header, t->header_size) != 0) {
+        t->errors++;
+        t->rx_retry = 1;
+    }
+}
+
+/* Sıradaki yuva boşsa başlığını almaya başlar, değilse alma bekletilir */
+static void receive_next(frame_transport_t *t) {
+    frame_slot_t *s = &t->slots[t->rx_slot];
+    if (s->state == SLOT_FREE) {
+        s->state = SLOT_RECEIVING;
+        t->rx_stalled = 0;
+        receive_header(t);
+    } else {
+        t->rx_stalled = 1;
+        t->rx_stalls++;
+    }
+}
+
+/* Yuva boşaldı: bekleyen alma varsa ve sıra bu yuvadaysa devam eder */
+static void release(frame_transport_t *t, frame_slot_t *s) {
+    s->state = SLOT_FREE;
+    if (t->rx_stalled && &t->slots[t->rx_slot] == s) receive_next(t);
+}
+
+/* Gönderim sırası bir sonraki işlenmiş karede. Cevapsız kareler sırayı
+ * bozmadan boşaltılır, ilk cevabı olan kare gönderilir. Başlatılamayan
+ * gönderimde yuva DONE'da kalır; sonraki çağrı (wait()) yeniden dener. */
+static void transmit_next(frame_transport_t *t) {
+    while (!t->tx_busy) {
+        frame_slot_t *s = &t->slots[t->tx_slot];
+        if (s->state != SLOT_DONE) return;
+        if (s->out_size == 0) {
+            t->tx_slot = (uint8_t)((t->tx_slot + 1) % FRAME_SLOTS);
+            release(t, s);
+            continue;
+        }
+        s->state = SLOT_SENDING;
+        t->tx_busy = 1;
+        if (t->port->start_transmit(t->port->ctx, s->data + s->out_offset, s->out_size) != 0) {
+            t->errors++;
+            t->tx_busy = 0;
+            s->state = SLOT_DONE;
+            return;
+        }
+    }
+}
+
+void frame_transport_init(frame_transport_t *t, const frame_port_t *port,
+                          frame_payload_size_t payload_size, uint32_t header_size,
+                          uint8_t *const *buffers, uint32_t slot_size) {
+    t->port = port;
+    t->payload_size = payload_size;
+    t->header_size = (header_size > FRAME_HEADER_MAX) ? FRAME_HEADER_MAX : header_size;
+    t->slot_size = slot_size;
+    for (int i = 0; i < FRAME_SLOTS; i++) {
+        t->slots[i].data = buffers[i];
+        t->slots[i].out_offset = 0;
+        t->slots[i].out_size = 0;
+        t->slots[i].state = SLOT_FREE;
+    }
+    t->rx_slot = t->process_slot = t->tx_slot = 0;
+    t->rx_payload = t->rx_stalled = t->tx_busy = t->rx_retry = 0;
+    t->frames_received = t->frames_sent = 0;
+    t->rx_stalls = t->skipped_headers = t->errors = 0;
+}
+
+void frame_transport_start(frame_transport_t *t) {
+    t->port->lock(t->port->ctx);
+    receive_next(t);
+    t->port->unlock(t->port->ctx);
+}
+
+frame_slot_t *frame_transport_next(frame_transport_t *t) {
+    frame_slot_t *s = &t->slots[t->process_slot];
+    frame_slot_t *result = NULL;
+
+    t->port->lock(t->port->ctx);
+    if (s->state == SLOT_READY) {
+        s->state = SLOT_PROCESSING;
+        t->process_slot = (uint8_t)((t->process_slot + 1) % FRAME_SLOTS);
+        result = s;
+    }
+    t->port->unlock(t->port->ctx);
+    return result;
+}
+
+void frame_transport_submit(frame_transport_t *t, frame_slot_t *slot,
+                            uint32_t out_offset, uint32_t out_size) {
+    t->port->lock(t->port->ctx);
+    slot->out_offset = out_offset;
+    slot->out_size = out_size;
+    slot->state = SLOT_DONE;
+    transmit_next(t);
+    t->port->unlock(t->port->ctx);
+}
+
+void frame_transport_wait(frame_transport_t *t) {
+    t->port->lock(t->port->ctx);
+    if (t->rx_retry) receive_header(t);
+    transmit_next(t);
+    if (t->slots[t->process_slot].state != SLOT_READY) t->port->wait(t->port->ctx);
+    t->port->unlock(t->port->ctx);
+}
+
+void frame_transport_rx_complete(frame_transport_t *t) {
+    frame_slot_t *s = &t->slots[t->rx_slot];
+
+    if (!t->rx_payload) {
+        uint32_t size = t->payload_size(s->header);
+        if (size == 0 || size > t->slot_size) {
+            t->skipped_headers++;
+            receive_header(t);
+            return;
+        }
+        t->rx_payload = 1;
+        // Veri alınamıyorsa kare atılır; wait() sıradaki başlığı bekler
+        if (t->port->start_receive(t->port->ctx, s->data, size) != 0) {
+            t->errors++;
+            t->rx_retry = 1;
+        }
+        return;
+    }
+
+    s->state = SLOT_READY;
+    t->frames_received++;
+    t->rx_slot = (uint8_t)((t->rx_slot + 1) % FRAME_SLOTS);
+    receive_next(t);
+}
+
+void frame_transport_tx_complete(frame_transport_t *t) {
+    frame_slot_t *s = &t->slots[t->tx_slot];
+
+    t->tx_busy = 0;
+    t->frames_sent++;
+    t->tx_slot = (uint8_t)((t->tx_slot + 1) % FRAME_SLOTS);
+    release(t, s);
+    transmit_next(t);
+}
+
+void frame_transport_error(frame_transport_t *t, uint32_t stopped) {
+    t->errors++;
+    if ((stopped & FRAME_ERROR_TX) && t->tx_busy) {
+        t->tx_busy = 0;
+        t->slots[t->tx_slot].state = SLOT_DONE;
+    }
+    // Alma kurulu değilse (yuva bekliyor ya da wait() deneyecek) dokunulmaz
+    if ((stopped & FRAME_ERROR_RX) && !t->rx_retry &&
+        t->slots[t->rx_slot].state == SLOT_RECEIVING) {
+        receive_header(t);
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * histogram.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "histogram.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+static inline uint32_t load_word(const uint8_t *p)
+{
+    uint32_t w;
+    memcpy(&w, p, 4);
+    return w;
+}
+
+static void count(const uint8_t *data, uint32_t size, uint32_t *h0, uint32_t *sub)
+{
+    uint32_t *h1 = sub, *h2 = sub + HISTOGRAM_BINS, *h3 = sub + 2 * HISTOGRAM_BINS;
+    uint32_t i = 0;
+
+    for (; i + 4 <= size; i += 4) {
+        uint32_t w = load_word(&data[i]);
+        h0[w & 0xFF]++;
+        h1[(w >> 8) & 0xFF]++;
+        h2[(w >> 16) & 0xFF]++;
+        h3[w >> 24]++;
+    }
+    for (; i < size; i++) {
+        h0[data[i]]++;
+    }
+}
+
+// histogram += the three sub-histograms
+static void merge(uint32_t *histogram, const uint32_t *sub)
+{
+    const uint32_t *h1 = sub, *h2 = sub + HISTOGRAM_BINS, *h3 = sub + 2 * HISTOGRAM_BINS;
+    int i = 0;
+#if defined(__SSE2__)
+    // Host build: 4 bins per addition
+    for (; i + 4 <= HISTOGRAM_BINS; i += 4) {
+        __m128i a = _mm_loadu_si128((const __m128i *)&histogram[i]);
+        __m128i b = _mm_add_epi32(_mm_loadu_si128((const __m128i *)&h1[i]),
+                                  _mm_loadu_si128((const __m128i *)&h2[i]));
+        a = _mm_add_epi32(a, _mm_loadu_si128((const __m128i *)&h3[i]));
+        _mm_storeu_si128((__m128i *)&histogram[i], _mm_add_epi32(a, b));
+    }
+#endif
+    for (; i < HISTOGRAM_BINS; i++) {
+        histogram[i] += h1[i] + h2[i] + h3[i];
+    }
+}
+
+void histogram_u8(const image_view_t *v, uint32_t *histogram, uint32_t *sub)
+{
+    memset(histogram, 0, HISTOGRAM_BINS * sizeof(uint32_t));
+    memset(sub, 0, HISTOGRAM_SUB_WORDS * sizeof(uint32_t));
+    for (uint32_t y = 0; y < v->height; y++) {
+        count(IMAGE_VIEW_ROW_U8(v, y), v->width, histogram, sub);
+    }
+    merge(histogram, sub);
+}
+
+void histogram_u8_add(const uint8_t *data, uint32_t size, uint32_t *histogram, uint32_t *sub)
+{
+    memset(sub, 0, HISTOGRAM_SUB_WORDS * sizeof(uint32_t));
+    count(data, size, histogram, sub);
+    merge(histogram, sub);
+}
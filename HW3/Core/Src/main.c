@@ -1,111 +1,101 @@
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
 #include <stdint.h>
-#include <stdlib.h>
+#include "mode_server.h"
+#include "frame_transport.h"
 
 /* Private defines -----------------------------------------------------------*/
-#define IMG_WIDTH  128
-#define IMG_HEIGHT 128
-#define IMG_SIZE   (IMG_WIDTH * IMG_HEIGHT)
+/* 1: alma/gönderme DMA ile, 0: kesme ile (HAL_UART_*_IT) */
+#define FRAME_USE_DMA 1
 
 /* Private variables ---------------------------------------------------------*/
 UART_HandleTypeDef huart2;
-uint8_t image_buf[IMG_SIZE];      // Q1 ve Q3 için 16KB
-uint8_t color_buf[IMG_SIZE * 3];  // Q2 için 48KB
-uint8_t temp_buf[IMG_SIZE];       // Morfoloji için geçici buffer
-uint8_t header[2];                // [Mode, Unused]
+DMA_HandleTypeDef hdma_usart2_rx;
+DMA_HandleTypeDef hdma_usart2_tx;
+/* İki kare yuvası, her biri en büyük kareyi (mod 2, 48KB) alır. Mod 5'in
+ * 12-bit histogramı da yuvanın boş kalan son 16KB'ında tutulur. */
+uint8_t frame_slots[FRAME_SLOTS][MODE_SLOT_SIZE] __attribute__((aligned(4)));
+frame_transport_t transport;
 
 /* Function Prototypes -------------------------------------------------------*/
 void SystemClock_Config(void);
 static void MX_GPIO_Init(void);
+static void MX_DMA_Init(void);
 static void MX_USART2_UART_Init(void);
-uint8_t compute_otsu(uint8_t *data, uint32_t size);
-void morph_dilation(uint8_t *src, uint8_t *dst);
-void morph_erosion(uint8_t *src, uint8_t *dst);
+
+/* HAL üzerinden frame_port_t */
+static int uart_start_receive(void *ctx, uint8_t *buf, uint32_t size) {
+#if FRAME_USE_DMA
+    return (HAL_UART_Receive_DMA(ctx, buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+#else
+    return (HAL_UART_Receive_IT(ctx, buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+#endif
+}
+
+static int uart_start_transmit(void *ctx, const uint8_t *buf, uint32_t size) {
+#if FRAME_USE_DMA
+    return (HAL_UART_Transmit_DMA(ctx, (uint8_t *)buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+#else
+    return (HAL_UART_Transmit_IT(ctx, (uint8_t *)buf, (uint16_t)size) == HAL_OK) ? 0 : -1;
+#endif
+}
+
+static void irq_lock(void *ctx) { (void)ctx; __disable_irq(); }
+static void irq_unlock(void *ctx) { (void)ctx; __enable_irq(); }
+/* Kesmeler kapalıyken çağrılır; __WFI() bekleyen kesmeyle uyanır, kesme
+ * unlock()'ta çalışır */
+static void wait_for_interrupt(void *ctx) { (void)ctx; __WFI(); }
+
+static const frame_port_t uart_port = {
+    uart_start_receive, uart_start_transmit, irq_lock, irq_unlock, wait_for_interrupt, &huart2
+};
+
+void HAL_UART_RxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart == &huart2) frame_transport_rx_complete(&transport);
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart) {
+    if (huart == &huart2) frame_transport_tx_complete(&transport);
+}
+
+/* Hata kesmesi alma ya da gönderme DMA'sından gelebilir. HAL durdurduğu
+ * yönün durumunu READY yapar (gürültü hatasında IT alma sürer), hangi
+ * yönün durduğu buradan anlaşılır. */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart) {
+    if (huart != &huart2) return;
+    uint32_t stopped = 0;
+    if (huart->RxState != HAL_UART_STATE_BUSY_RX) stopped |= FRAME_ERROR_RX;
+    if (huart->gState != HAL_UART_STATE_BUSY_TX) stopped |= FRAME_ERROR_TX;
+    frame_transport_error(&transport, stopped);
+}
 
 int main(void) {
   HAL_Init();
   SystemClock_Config();
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART2_UART_Init();
 
+  uint8_t *const buffers[FRAME_SLOTS] = { frame_slots[0], frame_slots[1] };
+  frame_transport_init(&transport, &uart_port, mode_payload_size, MODE_HEADER_SIZE,
+                       buffers, MODE_SLOT_SIZE);
+  frame_transport_start(&transport);
+
+  /* Kare N+1 alınırken kare N işlenir ve gönderilir; CPU sadece işleme
+   * süresince çalışır, geri kalanında kesme bekler. PC en fazla FRAME_SLOTS
+   * kareyi cevapsız bırakmalıdır: kare N+2'yi cevap N geldikten sonra gönderir. */
   while (1) {
-    /* PC'den mod bilgisini bekle */
-    if (HAL_UART_Receive(&huart2, header, 2, HAL_MAX_DELAY) == HAL_OK) {
-        uint8_t mode = header[0];
-
-        if (mode == 1) { // Q1: Grayscale Otsu
-            if (HAL_UART_Receive(&huart2, image_buf, IMG_SIZE, HAL_MAX_DELAY) == HAL_OK) {
-                uint8_t thr = compute_otsu(image_buf, IMG_SIZE);
-                for(int i=0; i<IMG_SIZE; i++) image_buf[i] = (image_buf[i] > thr) ? 255 : 0;
-                HAL_UART_Transmit(&huart2, image_buf, IMG_SIZE, HAL_MAX_DELAY);
-            }
-        }
-        else if (mode == 2) { // Q2: Color Otsu (Channel-wise)
-            if (HAL_UART_Receive(&huart2, color_buf, IMG_SIZE * 3, HAL_MAX_DELAY) == HAL_OK) {
-                for (int c = 0; c < 3; c++) {
-                    uint8_t *channel = &color_buf[c * IMG_SIZE];
-                    uint8_t thr = compute_otsu(channel, IMG_SIZE);
-                    for (int i = 0; i < IMG_SIZE; i++) channel[i] = (channel[i] > thr) ? 255 : 0;
-                }
-                HAL_UART_Transmit(&huart2, color_buf, IMG_SIZE * 3, HAL_MAX_DELAY);
-            }
-        }
-        else if (mode >= 3 && mode <= 4) { // Q3: Morphological (Dilation/Erosion)
-            if (HAL_UART_Receive(&huart2, image_buf, IMG_SIZE, HAL_MAX_DELAY) == HAL_OK) {
-                if (mode == 3) morph_dilation(image_buf, temp_buf);
-                else if (mode == 4) morph_erosion(image_buf, temp_buf);
-                HAL_UART_Transmit(&huart2, temp_buf, IMG_SIZE, HAL_MAX_DELAY);
-            }
-        }
+    frame_slot_t *slot = frame_transport_next(&transport);
+    if (slot == NULL) {
+        frame_transport_wait(&transport);
+        continue;
     }
+    uint32_t offset;
+    uint32_t size = mode_process(slot->header[0], slot->data, &offset);
+    frame_transport_submit(&transport, slot, offset, size);
   }
 }
 
-/* Otsu Method Implementation */
-uint8_t compute_otsu(uint8_t *data, uint32_t size) {
-    uint32_t hist[256] = {0};
-    for (uint32_t i = 0; i < size; i++) hist[data[i]]++;
-    float sum = 0, sumB = 0, varMax = 0;
-    for (int i = 0; i < 256; i++) sum += (float)i * hist[i];
-    int wB = 0, wF = 0; uint8_t threshold = 0;
-    for (int i = 0; i < 256; i++) {
-        wB += hist[i]; if (wB == 0) continue;
-        wF = size - wB; if (wF == 0) break;
-        sumB += (float)(i * hist[i]);
-        float mB = sumB / (float)wB, mF = (sum - sumB) / (float)wF;
-        float varBetween = (float)wB * (float)wF * (mB - mF) * (mB - mF);
-        if (varBetween > varMax) { varMax = varBetween; threshold = (uint8_t)i; }
-    }
-    return threshold;
-}
-
-/* Dilation: Nesneyi genişletir */
-void morph_dilation(uint8_t *src, uint8_t *dst) {
-    for (int y = 1; y < IMG_HEIGHT-1; y++) {
-        for (int x = 1; x < IMG_WIDTH-1; x++) {
-            uint8_t res = 0;
-            for (int ky = -1; ky <= 1; ky++)
-                for (int kx = -1; kx <= 1; kx++)
-                    if (src[(y+ky)*IMG_WIDTH + (x+kx)] == 255) res = 255;
-            dst[y*IMG_WIDTH + x] = res;
-        }
-    }
-}
-
-/* Erosion: Nesneyi inceltir */
-void morph_erosion(uint8_t *src, uint8_t *dst) {
-    for (int y = 1; y < IMG_HEIGHT-1; y++) {
-        for (int x = 1; x < IMG_WIDTH-1; x++) {
-            uint8_t res = 255;
-            for (int ky = -1; ky <= 1; ky++)
-                for (int kx = -1; kx <= 1; kx++)
-                    if (src[(y+ky)*IMG_WIDTH + (x+kx)] == 0) res = 0;
-            dst[y*IMG_WIDTH + x] = res;
-        }
-    }
-}
-
 /* Hardware Configuration Functions */
 void SystemClock_Config(void) {
   RCC_OscInitTypeDef RCC_OscInitStruct = {0};
@@ -133,3 +123,17 @@ static void MX_USART2_UART_Init(void) {
 }
 
 static void MX_GPIO_Init(void) { __HAL_RCC_GPIOA_CLK_ENABLE(); }
+
+/* USART2_RX: DMA1 Stream5, USART2_TX: DMA1 Stream6 (kanal 4) */
+static void MX_DMA_Init(void) {
+  __HAL_RCC_DMA1_CLK_ENABLE();
+  HAL_NVIC_SetPriority(DMA1_Stream5_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream5_IRQn);
+  HAL_NVIC_SetPriority(DMA1_Stream6_IRQn, 0, 0);
+  HAL_NVIC_EnableIRQ(DMA1_Stream6_IRQn);
+}
+
+void Error_Handler(void) {
+  __disable_irq();
+  while (1) {}
+}
@@ -0,0 +1,67 @@
+/*
+ * mode_server.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "mode_server.h"
+#include "image_view.h"
+#include "segmentation.h"
+#include "morphology.h"
+
+uint32_t mode_payload_size(const uint8_t *header) {
+    switch (header[0]) {
+    case 1: case 3: case 4: return IMG_SIZE;
+    case 2: return IMG_SIZE * 3;
+    case 5: return IMG_SIZE * 2;
+    default: return 0;
+    }
+}
+
+uint32_t mode_process(uint8_t mode, uint8_t *slot, uint32_t *out_offset) {
+    uint32_t hist[OTSU_HIST_WORDS_8];
+    *out_offset = 0;
+
+    if (mode == 1) { // Q1: Grayscale Otsu
+        image_view_t gray = image_view_make(slot, IMG_WIDTH, IMG_HEIGHT, PIXEL_U8);
+        uint8_t thr = compute_otsu(&gray, hist);
+        for (int i = 0; i < IMG_SIZE; i++) slot[i] = (slot[i] > thr) ? 255 : 0;
+        return IMG_SIZE;
+    }
+    else if (mode == 2) { // Q2: Color Otsu (Channel-wise)
+        for (int c = 0; c < 3; c++) {
+            uint8_t *channel = &slot[c * IMG_SIZE];
+            image_view_t plane = image_view_make(channel, IMG_WIDTH, IMG_HEIGHT, PIXEL_U8);
+            uint8_t thr = compute_otsu(&plane, hist);
+            for (int i = 0; i < IMG_SIZE; i++) channel[i] = (channel[i] > thr) ? 255 : 0;
+        }
+        return IMG_SIZE * 3;
+    }
+    else if (mode >= 3 && mode <= 4) { // Q3: Morphological (Dilation/Erosion)
+        /* Sadece nesnenin etrafındaki bölge işlenir, geri kalanı sıfır kalır */
+        uint8_t *result = slot + IMG_SIZE;
+        image_view_t in = image_view_make(slot, IMG_WIDTH, IMG_HEIGHT, PIXEL_U8);
+        image_view_t out = image_view_make(result, IMG_WIDTH, IMG_HEIGHT, PIXEL_U8);
+        uint16_t box[4];
+        foreground_bbox(&in, 2, box);
+        image_view_t roi = image_view_roi(&in, box[0], box[1], box[2], box[3]);
+        image_view_t out_roi = image_view_roi(&out, box[0], box[1], box[2], box[3]);
+        memset(result, 0, IMG_SIZE);
+        if (mode == 3) morph_dilation(&roi, &out_roi);
+        else morph_erosion(&roi, &out_roi);
+        *out_offset = IMG_SIZE;
+        return IMG_SIZE;
+    }
+    else if (mode == 5) { // 12-bit Grayscale Otsu, little-endian uint16_t pikseller
+        uint16_t *raw12 = (uint16_t *)slot;
+        image_view_t gray12 = IMAGE_VIEW_OF(raw12, IMG_WIDTH, IMG_HEIGHT);
+        uint16_t thr = compute_otsu_u16(&gray12, (uint32_t *)(slot + IMG_SIZE * 2));
+        /* i. çıkış byte'ı, i. pikselin kendisinden ve sonrakilerden önce gelir,
+         * bu yüzden sonuç yerinde yazılabilir */
+        for (int i = 0; i < IMG_SIZE; i++) slot[i] = (raw12[i] > thr) ? 255 : 0;
+        return IMG_SIZE;
+    }
+    return 0;
+}
@@ -0,0 +1,36 @@
+/*
+ * morphology.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include "morphology.h"
+
+/* Dilation: Nesneyi genişletir (view'ın kenar pikselleri yazılmaz) */
+void morph_dilation(const image_view_t *src, const image_view_t *dst) {
+    for (int y = 1; y < src->height-1; y++) {
+        uint8_t *out = IMAGE_VIEW_ROW_U8(dst, y);
+        for (int x = 1; x < src->width-1; x++) {
+            uint8_t res = 0;
+            for (int ky = -1; ky <= 1; ky++)
+                for (int kx = -1; kx <= 1; kx++)
+                    if (IMAGE_VIEW_ROW_U8(src, y+ky)[x+kx] == 255) res = 255;
+            out[x] = res;
+        }
+    }
+}
+
+/* Erosion: Nesneyi inceltir (view'ın kenar pikselleri yazılmaz) */
+void morph_erosion(const image_view_t *src, const image_view_t *dst) {
+    for (int y = 1; y < src->height-1; y++) {
+        uint8_t *out = IMAGE_VIEW_ROW_U8(dst, y);
+        for (int x = 1; x < src->width-1; x++) {
+            uint8_t res = 255;
+            for (int ky = -1; ky <= 1; ky++)
+                for (int kx = -1; kx <= 1; kx++)
+                    if (IMAGE_VIEW_ROW_U8(src, y+ky)[x+kx] == 0) res = 0;
+            out[x] = res;
+        }
+    }
+}
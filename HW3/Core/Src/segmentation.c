@@ -0,0 +1,91 @@
+/*
+ * segmentation.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <string.h>
+#include "segmentation.h"
+#include "histogram.h"
+
+/* Otsu Method Implementation
+ * Tek tanım, her piksel tipi için ayrı açılır (derleme zamanında, piksel başına
+ * tip kontrolü yok). 8-bit: 256 bin. 12-bit (uint16_t) ve float: 4096 bin,
+ * float [0, 1] aralığında kabul edilir. Dönen eşik, piksel ile aynı ölçektedir. */
+static inline uint32_t bin_u16(uint16_t v) { return (v > PIXEL_U16_MAX) ? PIXEL_U16_MAX : v; }
+static inline uint32_t bin_f32(float v) {
+    if (!(v > 0.0f)) return 0;
+    if (v >= 1.0f) return PIXEL_U16_MAX;
+    return (uint32_t)(v * (float)PIXEL_U16_MAX + 0.5f);
+}
+static inline uint8_t level_u8(int i) { return (uint8_t)i; }
+static inline uint16_t level_u16(int i) { return (uint16_t)i; }
+static inline float level_f32(int i) { return ((float)i + 0.5f) / (float)PIXEL_U16_MAX; }
+
+/* 12-bit ve float histogramlar doğrudan doldurulur; 8-bit histogram_u8() ile
+ * (dört alt histogram, histogram.c; üçü hist'in 256. elemanından sonra).
+ * 4096 bin için alt histogramlar 64KB tutacağından orada kullanılmaz. */
+static void fill_u8(const image_view_t *v, uint32_t *hist) {
+    histogram_u8(v, hist, hist + OTSU_BINS_8);
+}
+
+#define DEFINE_FILL(NAME, T, ROW, BINS, BIN)                             \
+static void NAME(const image_view_t *v, uint32_t *hist) {                \
+    memset(hist, 0, BINS * sizeof(uint32_t));                            \
+    for (uint32_t y = 0; y < v->height; y++) {                           \
+        const T *row = ROW(v, y);                                        \
+        for (uint32_t x = 0; x < v->width; x++) hist[BIN(row[x])]++;     \
+    }                                                                    \
+}
+
+DEFINE_FILL(fill_u16, uint16_t, IMAGE_VIEW_ROW_U16, OTSU_BINS_12, bin_u16)
+DEFINE_FILL(fill_f32, float,    IMAGE_VIEW_ROW_F32, OTSU_BINS_12, bin_f32)
+
+/* 8-bit toplamlar float'a sığar (255 * 16384 < 2^24), 12-bit için 64-bit tamsayı */
+#define DEFINE_OTSU(NAME, RESULT_T, BINS, SUM_T, FILL, LEVEL)            \
+RESULT_T NAME(const image_view_t *v, uint32_t *hist) {                   \
+    FILL(v, hist);                                                       \
+    uint32_t size = (uint32_t)v->width * v->height;                      \
+    SUM_T sum = 0, sumB = 0; float varMax = 0;                           \
+    for (uint32_t i = 0; i < BINS; i++) sum += (SUM_T)i * hist[i];       \
+    uint32_t wB = 0, wF = 0, threshold = 0;                              \
+    for (uint32_t i = 0; i < BINS; i++) {                                \
+        wB += hist[i]; if (wB == 0) continue;                            \
+        wF = size - wB; if (wF == 0) break;                              \
+        sumB += (SUM_T)(i * hist[i]);                                    \
+        float mB = (float)sumB / (float)wB, mF = (float)(sum - sumB) / (float)wF; \
+        float varBetween = (float)wB * (float)wF * (mB - mF) * (mB - mF); \
+        if (varBetween > varMax) { varMax = varBetween; threshold = i; } \
+    }                                                                    \
+    return LEVEL((int)threshold);                                        \
+}
+
+DEFINE_OTSU(compute_otsu,     uint8_t,  OTSU_BINS_8,  float,    fill_u8,      level_u8)
+DEFINE_OTSU(compute_otsu_u16, uint16_t, OTSU_BINS_12, uint64_t, fill_u16,     level_u16)
+DEFINE_OTSU(compute_otsu_f32, float,    OTSU_BINS_12, uint64_t, fill_f32,     level_f32)
+
+void foreground_bbox(const image_view_t *v, uint16_t margin, uint16_t box[4]) {
+    int x0 = v->width, y0 = v->height, x1 = -1, y1 = -1;
+    for (int y = 0; y < v->height; y++) {
+        const uint8_t *row = IMAGE_VIEW_ROW_U8(v, y);
+        for (int x = 0; x < v->width; x++) {
+            if (row[x]) {
+                if (x < x0) x0 = x;
+                if (x > x1) x1 = x;
+                if (y < y0) y0 = y;
+                y1 = y;
+            }
+        }
+    }
+    if (x1 < 0) {
+        box[0] = box[1] = box[2] = box[3] = 0;
+        return;
+    }
+    x0 = (x0 > margin) ? x0 - margin : 0;
+    y0 = (y0 > margin) ? y0 - margin : 0;
+    box[0] = (uint16_t)x0;
+    box[1] = (uint16_t)y0;
+    box[2] = (uint16_t)(x1 + margin + 1 - x0);
+    box[3] = (uint16_t)(y1 + margin + 1 - y0);
+}
@@ -0,0 +1,175 @@
+/*
+ * bench_conv_strategy.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stdio.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "conv_plan.h"
+#include "spatial_filters.h"
+
+/*
+ * Time of every convolution strategy against the kernel size, which is
+ * where the CONV_SEPARABLE_MIN_KERNEL and CONV_FFT_MIN_KERNEL crossovers in
+ * conv_plan.h come from.
+ *     bench_conv_strategy [width] [height]
+ * A Gaussian (rank 1) kernel runs direct and separable, a random
+ * non-separable one direct and FFT. Each result is compared with
+ * apply_2d_convolution(): more than one level of difference is reported
+ * and makes the exit status 1.
+ *
+ * A time is the best of REPEATS batches of at least MIN_SECONDS each, in
+ * thread CPU time. The two strategies of a kernel take turns batch by batch,
+ * so a slow spell of the machine hits both, and the crossovers do not move
+ * between runs.
+ */
+#define MIN_SECONDS 0.05
+#define REPEATS 9
+
+static const int kernel_sizes[] = { 3, 5, 7, 9, 11, 15, 21, 31 };
+#define NUM_KERNELS (int)(sizeof(kernel_sizes) / sizeof(kernel_sizes[0]))
+
+static const char *const strategy_names[] = { "direct", "separable", "fft" };
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void gaussian_kernel(float *k, int size)
+{
+    float sigma = size / 5.0f, g[CONV_PLAN_MAX_KERNEL], sum = 0.0f;
+    int c = size / 2;
+
+    for (int i = 0; i < size; i++) {
+        float d = (float)(i - c);
+        g[i] = expf(-d * d / (2.0f * sigma * sigma));
+        sum += g[i];
+    }
+    for (int j = 0; j < size; j++) {
+        for (int i = 0; i < size; i++) k[j * size + i] = g[j] * g[i] / (sum * sum);
+    }
+}
+
+// Positive weights summing to one, so the output stays inside 0..255
+static void random_kernel(float *k, int size, uint32_t *seed)
+{
+    float sum = 0.0f;
+
+    for (int i = 0; i < size * size; i++) {
+        *seed = *seed * 1664525u + 1013904223u;
+        k[i] = (float)((*seed >> 16) & 0xFF) + 1.0f;
+        sum += k[i];
+    }
+    for (int i = 0; i < size * size; i++) k[i] /= sum;
+}
+
+// Seconds per call of one batch of at least MIN_SECONDS
+static double time_batch(const conv_plan_t *plan, const image_view_t *src, const image_view_t *dst)
+{
+    int runs = 0;
+    double start = now(), elapsed;
+
+    do {
+        conv_plan_apply(plan, src, dst);
+        runs++;
+        elapsed = now() - start;
+    } while (elapsed < MIN_SECONDS);
+    return elapsed / runs;
+}
+
+int main(int argc, char **argv)
+{
+    int width = (argc > 1) ? atoi(argv[1]) : 640;
+    int height = (argc > 2) ? atoi(argv[2]) : 480;
+    size_t pixels = (size_t)width * height;
+    uint8_t *in = malloc(pixels), *out = malloc(pixels), *ref = malloc(pixels);
+    float *workspace = malloc(CONV_PLAN_WORKSPACE_FLOATS(width, CONV_PLAN_MAX_KERNEL) * sizeof(float));
+    uint32_t seed = 12345;
+    int failed = 0;
+
+    if (!in || !out || !ref || !workspace) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (size_t i = 0; i < pixels; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (uint8_t)(seed >> 24);
+    }
+    image_view_t src = image_view_make(in, width, height, PIXEL_U8);
+    image_view_t dst = image_view_make(out, width, height, PIXEL_U8);
+    image_view_t ref_view = image_view_make(ref, width, height, PIXEL_U8);
+
+    printf("%dx%d\n%-9s %5s %-10s %9s %8s %9s %5s\n", width, height,
+           "kernel", "size", "strategy", "ms", "speedup", "mismatch", "auto");
+
+    for (int s = 0; s < NUM_KERNELS; s++) {
+        int size = kernel_sizes[s];
+        float kernel[CONV_PLAN_MAX_KERNEL * CONV_PLAN_MAX_KERNEL];
+
+        for (int shape = 0; shape < 2; shape++) {
+            const char *shape_name = shape ? "random" : "gaussian";
+            conv_strategy_t other = shape ? CONV_FFT : CONV_SEPARABLE;
+            conv_strategy_t tried[2] = { CONV_DIRECT, other };
+            conv_plan_t plans[2];
+            int possible[2];
+            double seconds[2] = { 0.0, 0.0 };
+
+            if (shape) random_kernel(kernel, size, &seed);
+            else gaussian_kernel(kernel, size);
+            apply_2d_convolution(&src, &ref_view, kernel, size);
+
+            conv_plan_init(&plans[0], kernel, size, (uint16_t)width, CONV_AUTO, workspace);
+            int chosen = plans[0].strategy;
+
+            // The direct plan uses no workspace, so both plans can coexist
+            for (int t = 0; t < 2; t++) {
+                possible[t] = conv_plan_init(&plans[t], kernel, size, (uint16_t)width, tried[t],
+                                             workspace) >= 0;
+            }
+            for (int r = 0; r < REPEATS; r++) {
+                for (int t = 0; t < 2; t++) {
+                    if (!possible[t]) continue;
+                    double batch = time_batch(&plans[t], &src, &dst);
+                    if (r == 0 || batch < seconds[t]) seconds[t] = batch;
+                }
+            }
+
+            for (int t = 0; t < 2; t++) {
+                if (!possible[t]) {
+                    printf("%-9s %5d %-10s not possible\n", shape_name, size, strategy_names[tried[t]]);
+                    continue;
+                }
+                uint32_t mismatches = 0;
+                int max_diff = 0;
+
+                conv_plan_apply(&plans[t], &src, &dst);
+                for (size_t i = 0; i < pixels; i++) {
+                    int d = abs((int)out[i] - (int)ref[i]);
+                    if (d) mismatches++;
+                    if (d > max_diff) max_diff = d;
+                }
+                printf("%-9s %5d %-10s %9.2f %8.2f %9u %5s\n", shape_name, size,
+                       strategy_names[tried[t]], seconds[t] * 1e3,
+                       possible[0] ? seconds[0] / seconds[t] : 0.0, mismatches,
+                       chosen == (int)tried[t] ? "*" : "");
+                if (max_diff > 1) {
+                    printf("  %s differs by up to %d levels\n", strategy_names[tried[t]], max_diff);
+                    failed = 1;
+                }
+            }
+        }
+    }
+    free(in);
+    free(out);
+    free(ref);
+    free(workspace);
+    return failed;
+}
@@ -0,0 +1,129 @@
+/*
+ * bench_point_ops.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "point_ops.h"
+
+/*
+ * The HW1 Q1-Q4 transforms on a PC: the original per-pixel loops of
+ * HW1/Src/main.c (XOR, compare, pow() and double arithmetic) against the
+ * lookup tables of point_ops.c applied with point_op_apply().
+ *     bench_point_ops [width] [height]
+ * The frame is random and contains every level. Each table output is
+ * compared with its loop; a mismatch is printed and makes the exit status 1.
+ *
+ * A time is the best of REPEATS batches of at least MIN_SECONDS each, in
+ * thread CPU time, with the loop and the table taking turns batch by batch.
+ */
+#define MIN_SECONDS 0.02
+#define REPEATS 9
+
+enum { OP_NEG, OP_THRESHOLD, OP_GC3, OP_GC1_3, OP_PWLT, NUM_OPS };
+
+static const char *const op_names[NUM_OPS] = { "negative", "threshold", "gamma 3", "gamma 1/3", "piecewise" };
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// The loops of q1_q4_reference() in HW1/Src/main.c, expressions unchanged
+static void reference_loop(int op, const uint8_t *a, uint8_t *out, uint32_t size)
+{
+    const int T = POINT_OPS_T;
+    const double f1 = 128.0 / T;
+    const double f2 = (255.0 - 128.0) / (255.0 - T);
+
+    switch (op) {
+    case OP_NEG:
+        for (uint32_t i = 0; i < size; i++) out[i] = a[i] ^ 0xFF;
+        break;
+    case OP_THRESHOLD:
+        for (uint32_t i = 0; i < size; i++) out[i] = a[i] > T ? 0xFF : 0x00;
+        break;
+    case OP_GC3:
+        for (uint32_t i = 0; i < size; i++) out[i] = 0xFF * pow((a[i] / 255.0), 1.0 / 3.0);
+        break;
+    case OP_GC1_3:
+        for (uint32_t i = 0; i < size; i++) out[i] = 0xFF * pow((a[i] / 255.0), 3.0);
+        break;
+    default:
+        for (uint32_t i = 0; i < size; i++) {
+            if (a[i] <= T) out[i] = f1 * (double)a[i];
+            else out[i] = 128.0 + f2 * ((double)a[i] - T);
+        }
+        break;
+    }
+}
+
+// Seconds per frame of one batch of at least MIN_SECONDS
+static double time_batch(int op, const uint8_t *lut, const uint8_t *a, uint8_t *out, uint32_t size)
+{
+    int runs = 0;
+    double start = now(), elapsed;
+
+    do {
+        if (lut) point_op_apply(lut, a, out, size);
+        else reference_loop(op, a, out, size);
+        runs++;
+        elapsed = now() - start;
+    } while (elapsed < MIN_SECONDS);
+    return elapsed / runs;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t width = (argc > 1) ? (uint32_t)atoi(argv[1]) : 640;
+    uint32_t height = (argc > 2) ? (uint32_t)atoi(argv[2]) : 480;
+    uint32_t size = width * height;
+    const uint8_t *const luts[NUM_OPS] = { lut_neg, lut_thresholded, lut_gc3, lut_gc1_3, lut_pwlt };
+    uint8_t *in = malloc(size), *ref = malloc(size), *out = malloc(size);
+    uint32_t seed = 12345;
+    int failed = 0;
+
+    if (size < 256 || !in || !ref || !out) {
+        fprintf(stderr, "need at least 256 pixels\n");
+        return 1;
+    }
+    for (uint32_t i = 0; i < size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        in[i] = (i < 256) ? (uint8_t)i : (uint8_t)(seed >> 24);
+    }
+
+    printf("%ux%u\n%-10s %10s %10s %8s %9s\n", width, height, "transform", "loop ms", "table ms",
+           "speedup", "mismatch");
+    for (int op = 0; op < NUM_OPS; op++) {
+        double loop = 0.0, table = 0.0;
+
+        for (int r = 0; r < REPEATS; r++) {
+            double t = time_batch(op, NULL, in, ref, size);
+            if (r == 0 || t < loop) loop = t;
+            t = time_batch(op, luts[op], in, out, size);
+            if (r == 0 || t < table) table = t;
+        }
+
+        uint32_t mismatches = 0;
+        for (uint32_t i = 0; i < size; i++) {
+            if (out[i] == ref[i]) continue;
+            if (mismatches++ == 0) {
+                printf("  %s: level %u gives %u, the loop %u\n", op_names[op], in[i], out[i], ref[i]);
+            }
+        }
+        printf("%-10s %10.3f %10.3f %8.1f %9u\n", op_names[op], loop * 1e3, table * 1e3,
+               loop / table, mismatches);
+        if (mismatches) failed = 1;
+    }
+    free(in);
+    free(ref);
+    free(out);
+    return failed;
+}
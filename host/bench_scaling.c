@@ -0,0 +1,162 @@
+/*
+ * bench_scaling.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "tiled_filters.h"
+#include "spatial_filters.h"
+#include "morphology.h"
+
+/*
+ * Throughput of the tiled host backend for frame sizes from 64x64 to
+ * 8192x8192 and 1, 2, 4, ... up to max_threads workers.
+ *     bench_scaling [max_threads] [max_size] [tile_size]
+ * Frames up to VERIFY_MAX_SIZE are also checked against the whole-frame
+ * kernel; a mismatch is reported and makes the exit status 1.
+ */
+#define VERIFY_MAX_SIZE 1024
+#define MIN_SECONDS 0.25
+
+static const float low_pass_kernel_3x3[9] = {
+    1.0f/9.0f, 1.0f/9.0f, 1.0f/9.0f,
+    1.0f/9.0f, 1.0f/9.0f, 1.0f/9.0f,
+    1.0f/9.0f, 1.0f/9.0f, 1.0f/9.0f
+};
+
+static const int sizes[] = { 64, 256, 1024, 2048, 4096, 8192 };
+#define NUM_SIZES (int)(sizeof(sizes) / sizeof(sizes[0]))
+
+typedef struct {
+    const char *name;
+    tiled_filter_t filter;
+    int binary;             // morphology runs on a 0/255 frame
+} bench_op_t;
+
+static const bench_op_t ops[] = {
+    { "conv3x3",  { TILED_CONVOLUTION, low_pass_kernel_3x3, 3 }, 0 },
+    { "median3x3", { TILED_MEDIAN, NULL, 3 }, 0 },
+    { "dilation", { TILED_DILATION, NULL, 3 }, 1 },
+    { "erosion",  { TILED_EROSION, NULL, 3 }, 1 },
+};
+#define NUM_OPS (int)(sizeof(ops) / sizeof(ops[0]))
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Noise over smooth gradients, so the median sorts real data
+static void fill_frame(uint8_t *gray, uint8_t *binary, int size)
+{
+    uint32_t seed = 12345;
+
+    for (int y = 0; y < size; y++) {
+        for (int x = 0; x < size; x++) {
+            seed = seed * 1664525u + 1013904223u;
+            int v = ((x + y) * 255) / (2 * size) + (int)(seed >> 28) - 8;
+            gray[(size_t)y * size + x] = (uint8_t)(v < 0 ? 0 : v > 255 ? 255 : v);
+            binary[(size_t)y * size + x] = ((seed >> 24) & 0x7F) < 40 ? 255 : 0;
+        }
+    }
+}
+
+// 1, 2, 4, ... and finally max itself; 0 when done
+static int next_threads(int threads, int max)
+{
+    if (threads >= max) return 0;
+    return (threads * 2 < max) ? threads * 2 : max;
+}
+
+static void reference(const bench_op_t *op, const image_view_t *src, const image_view_t *dst)
+{
+    switch (op->filter.op) {
+    case TILED_CONVOLUTION: apply_2d_convolution(src, dst, op->filter.kernel, op->filter.kernel_size); break;
+    case TILED_MEDIAN:      apply_median_filtering(src, dst, op->filter.kernel_size); break;
+    case TILED_DILATION:    morph_dilation(src, dst); break;
+    case TILED_EROSION:     morph_erosion(src, dst); break;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int max_threads = (argc > 1) ? atoi(argv[1]) : (int)sysconf(_SC_NPROCESSORS_ONLN);
+    int max_size = (argc > 2) ? atoi(argv[2]) : 8192;
+    int tile_size = (argc > 3) ? atoi(argv[3]) : TILED_DEFAULT_TILE;
+    int failed = 0;
+
+    if (max_threads < 1) max_threads = 1;
+    if (max_threads > TILE_POOL_MAX_THREADS) max_threads = TILE_POOL_MAX_THREADS;
+
+    printf("%-10s %6s %7s %10s %8s %7s\n", "op", "size", "threads", "Mpix/s", "speedup", "steals");
+
+    for (int s = 0; s < NUM_SIZES && sizes[s] <= max_size; s++) {
+        int size = sizes[s];
+        size_t pixels = (size_t)size * size;
+        uint8_t *gray = malloc(pixels), *binary = malloc(pixels);
+        uint8_t *out = calloc(pixels, 1), *ref = calloc(pixels, 1);
+        if (!gray || !binary || !out || !ref) {
+            fprintf(stderr, "out of memory at %dx%d\n", size, size);
+            return 1;
+        }
+        fill_frame(gray, binary, size);
+
+        for (int o = 0; o < NUM_OPS; o++) {
+            const bench_op_t *op = &ops[o];
+            image_view_t src = image_view_make(op->binary ? binary : gray, size, size, PIXEL_U8);
+            image_view_t dst = image_view_make(out, size, size, PIXEL_U8);
+            image_view_t ref_view = image_view_make(ref, size, size, PIXEL_U8);
+            double base = 0.0;
+
+            if (size <= VERIFY_MAX_SIZE) {
+                memset(ref, 0, pixels);
+                reference(op, &src, &ref_view);
+            }
+
+            for (int threads = 1; threads > 0; threads = next_threads(threads, max_threads)) {
+                tile_pool_t *pool = malloc(sizeof(tile_pool_t));
+                if (!pool || tile_pool_init(pool, threads) != 0) {
+                    fprintf(stderr, "cannot start %d threads\n", threads);
+                    return 1;
+                }
+
+                memset(out, 0, pixels);
+                int runs = 0;
+                double start = now(), elapsed;
+                do {
+                    if (tiled_filter_run(pool, &op->filter, &src, &dst, tile_size) != 0) {
+                        fprintf(stderr, "out of memory for tile buffers\n");
+                        return 1;
+                    }
+                    runs++;
+                    elapsed = now() - start;
+                } while (elapsed < MIN_SECONDS);
+
+                double mpix = (double)pixels * runs / elapsed / 1e6;
+                if (threads == 1) base = mpix;
+                printf("%-10s %6d %7d %10.1f %8.2f %7u\n", op->name, size, threads, mpix,
+                       mpix / base, (unsigned)atomic_load(&pool->steals));
+
+                if (size <= VERIFY_MAX_SIZE && memcmp(out, ref, pixels) != 0) {
+                    printf("  MISMATCH against the whole-frame %s\n", op->name);
+                    failed = 1;
+                }
+                tile_pool_destroy(pool);
+                free(pool);
+            }
+        }
+        free(gray);
+        free(binary);
+        free(out);
+        free(ref);
+    }
+    return failed;
+}
@@ -0,0 +1,282 @@
+/*
+ * bench_uart_transport.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "uart_pty_port.h"
+#include "frame_transport.h"
+#include "mode_server.h"
+
+/*
+ * The HW3 mode server on Linux: frame_transport.c and mode_server.c as the
+ * board builds them, with the UART replaced by a pseudo-terminal paced at
+ * the board's baud rate (uart_pty_port.c).
+ *     bench_uart_transport [frames] [baud] [faults]
+ * A client thread sends frames of every mode, keeping at most FRAME_SLOTS
+ * of them unanswered, and one header with an unknown mode, which the
+ * server must skip. Every reply is compared with mode_process() on a copy
+ * of its frame; a mismatch is reported and makes the exit status 1. The
+ * total time is compared with the blocking loop, which receives, processes
+ * and sends one frame after the other.
+ *
+ * With faults set to 1, the port refuses one receive start and aborts one
+ * receive before the first header, then does the same to the first reply.
+ * Neither loses a byte. Every frame must still be answered, and the
+ * transport must count exactly these four errors.
+ */
+#define DEFAULT_FRAMES 10
+#define DEFAULT_BAUD 921600
+#define BOGUS_BEFORE 3          // an unknown-mode header precedes this frame
+#define FAULTS 4                // two on the receive side, two on the reply
+
+typedef struct {
+    uint8_t header[MODE_HEADER_SIZE];
+    uint8_t *payload;
+    uint32_t payload_size;
+    uint8_t *reply;             // expected
+    uint32_t reply_size;
+} test_frame_t;
+
+typedef struct {
+    int fd;
+    test_frame_t *frames;
+    int count;
+    pthread_mutex_t mutex;
+    pthread_cond_t replied;
+    int replies;
+} client_t;
+
+typedef struct {
+    frame_transport_t *transport;
+    atomic_int stop;            // set once every reply has arrived
+    double process_seconds;
+} server_t;
+
+static uint8_t slots[FRAME_SLOTS][MODE_SLOT_SIZE] __attribute__((aligned(4)));
+
+static void rx_complete(void *ctx) { frame_transport_rx_complete(ctx); }
+static void tx_complete(void *ctx) { frame_transport_tx_complete(ctx); }
+
+static void transport_error(void *ctx, uint32_t stopped)
+{
+    frame_transport_error(ctx, ((stopped & UART_PTY_ERROR_RX) ? FRAME_ERROR_RX : 0) |
+                               ((stopped & UART_PTY_ERROR_TX) ? FRAME_ERROR_TX : 0));
+}
+
+static const uart_pty_handlers_t pty_handlers = { rx_complete, tx_complete, transport_error };
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int write_all(int fd, const uint8_t *buf, uint32_t size)
+{
+    while (size) {
+        ssize_t w = write(fd, buf, size);
+        if (w <= 0) return -1;
+        buf += w;
+        size -= (uint32_t)w;
+    }
+    return 0;
+}
+
+static int read_all(int fd, uint8_t *buf, uint32_t size)
+{
+    while (size) {
+        ssize_t r = read(fd, buf, size);
+        if (r <= 0) return -1;
+        buf += r;
+        size -= (uint32_t)r;
+    }
+    return 0;
+}
+
+// Modes 1..5 in turn: gradients with noise, binary blobs for the morphology
+static void make_frame(test_frame_t *f, int index, uint32_t *seed)
+{
+    static const uint8_t modes[] = { 1, 3, 5, 2, 4 };
+    uint8_t mode = modes[index % 5];
+    uint8_t header[MODE_HEADER_SIZE] = { mode, 0 };
+    static uint8_t scratch[MODE_SLOT_SIZE] __attribute__((aligned(4)));
+    uint32_t offset;
+
+    memcpy(f->header, header, MODE_HEADER_SIZE);
+    f->payload_size = mode_payload_size(header);
+    f->payload = malloc(f->payload_size);
+    for (uint32_t i = 0; i < f->payload_size; i++) {
+        *seed = *seed * 1664525u + 1013904223u;
+        uint32_t x = i % IMG_WIDTH, y = (i / IMG_WIDTH) % IMG_HEIGHT;
+        if (mode == 3 || mode == 4) {
+            int dx = (int)x - 64, dy = (int)y - 64;
+            f->payload[i] = (dx * dx + dy * dy < 900 || (*seed >> 28) == 0) ? 255 : 0;
+        } else if (mode == 5) {
+            // Little-endian 12-bit samples: low byte, then the high 4 bits
+            uint32_t v = ((x + y) * 16 + (*seed >> 24)) & 0xFFF;
+            f->payload[i] = (i & 1) ? (uint8_t)(v >> 8) : (uint8_t)v;
+        } else {
+            f->payload[i] = (uint8_t)((x + 2 * y) / 3 + (*seed >> 27) + (i / IMG_SIZE) * 40);
+        }
+    }
+
+    memcpy(scratch, f->payload, f->payload_size);
+    f->reply_size = mode_process(mode, scratch, &offset);
+    f->reply = malloc(f->reply_size);
+    memcpy(f->reply, scratch + offset, f->reply_size);
+}
+
+static void *client_writer(void *arg)
+{
+    client_t *c = arg;
+    static const uint8_t bogus[MODE_HEADER_SIZE] = { 9, 0 };
+
+    for (int i = 0; i < c->count; i++) {
+        // A window of FRAME_SLOTS frames: frame i waits for reply i - FRAME_SLOTS
+        pthread_mutex_lock(&c->mutex);
+        while (i - c->replies >= FRAME_SLOTS) pthread_cond_wait(&c->replied, &c->mutex);
+        pthread_mutex_unlock(&c->mutex);
+
+        if (i == BOGUS_BEFORE && write_all(c->fd, bogus, MODE_HEADER_SIZE) != 0) break;
+        if (write_all(c->fd, c->frames[i].header, MODE_HEADER_SIZE) != 0 ||
+            write_all(c->fd, c->frames[i].payload, c->frames[i].payload_size) != 0) {
+            break;
+        }
+    }
+    return NULL;
+}
+
+// The board's main loop; it keeps polling after the last frame, which may still wait for a retry
+static void *server_main(void *arg)
+{
+    server_t *s = arg;
+
+    while (!atomic_load(&s->stop)) {
+        frame_slot_t *slot = frame_transport_next(s->transport);
+        if (slot == NULL) {
+            frame_transport_wait(s->transport);
+            continue;
+        }
+        uint32_t offset;
+        double start = now();
+        uint32_t size = mode_process(slot->header[0], slot->data, &offset);
+        s->process_seconds += now() - start;
+        frame_transport_submit(s->transport, slot, offset, size);
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : DEFAULT_FRAMES;
+    uint32_t baud = (argc > 2) ? (uint32_t)atoi(argv[2]) : DEFAULT_BAUD;
+    int faults = (argc > 3) ? atoi(argv[3]) : 0;
+    uint32_t seed = 12345;
+    uint64_t line_bytes = 0;
+    int failed = 0;
+
+    if (count < 1) count = 1;
+    test_frame_t *frames = calloc((size_t)count, sizeof(test_frame_t));
+    uint8_t *reply = malloc(MODE_SLOT_SIZE);
+    if (!frames || !reply) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (int i = 0; i < count; i++) {
+        make_frame(&frames[i], i, &seed);
+        line_bytes += MODE_HEADER_SIZE + frames[i].payload_size + frames[i].reply_size;
+    }
+
+    uart_pty_port_t pty;
+    frame_transport_t transport;
+    client_t client = { .frames = frames, .count = count, .replies = 0 };
+    uint8_t *const buffers[FRAME_SLOTS] = { slots[0], slots[1] };
+
+    if (uart_pty_open(&pty, baud, &client.fd) != 0) {
+        perror("pty");
+        return 1;
+    }
+    const frame_port_t port = {
+        uart_pty_start_receive, uart_pty_start_transmit,
+        uart_pty_lock, uart_pty_unlock, uart_pty_wait, &pty
+    };
+    frame_transport_init(&transport, &port, mode_payload_size, MODE_HEADER_SIZE,
+                         buffers, MODE_SLOT_SIZE);
+    if (uart_pty_start(&pty, &pty_handlers, &transport) != 0) {
+        perror("pthread_create");
+        return 1;
+    }
+    pthread_mutex_init(&client.mutex, NULL);
+    pthread_cond_init(&client.replied, NULL);
+
+    server_t server = { &transport, 0, 0.0 };
+    pthread_t server_thread, writer_thread;
+    if (faults) {
+        pthread_mutex_lock(&pty.mutex);
+        pty.fail_rx_starts = 1;
+        pty.abort_rx = 1;
+        pty.fail_tx_starts = 1;
+        pty.abort_tx = 1;
+        pthread_mutex_unlock(&pty.mutex);
+    }
+
+    double start = now();
+    frame_transport_start(&transport);
+    pthread_create(&server_thread, NULL, server_main, &server);
+    pthread_create(&writer_thread, NULL, client_writer, &client);
+
+    for (int i = 0; i < count; i++) {
+        if (read_all(client.fd, reply, frames[i].reply_size) != 0) {
+            fprintf(stderr, "connection lost at frame %d\n", i);
+            return 1;
+        }
+        if (memcmp(reply, frames[i].reply, frames[i].reply_size) != 0) {
+            printf("  MISMATCH in the reply to frame %d (mode %u)\n", i, frames[i].header[0]);
+            failed = 1;
+        }
+        pthread_mutex_lock(&client.mutex);
+        client.replies++;
+        pthread_cond_broadcast(&client.replied);
+        pthread_mutex_unlock(&client.mutex);
+    }
+    double elapsed = now() - start;
+    atomic_store(&server.stop, 1);
+
+    pthread_join(writer_thread, NULL);
+    pthread_join(server_thread, NULL);
+    close(client.fd);
+    uart_pty_close(&pty);
+
+    double line = (baud) ? (double)line_bytes * 10.0 / baud : 0.0;
+    printf("%d frames at %u baud\n", count, baud);
+    printf("  double-buffered   %8.3f s\n", elapsed);
+    printf("  blocking (est.)   %8.3f s  (line %.3f s + processing %.3f s)\n",
+           line + server.process_seconds, line, server.process_seconds);
+    printf("  speedup           %8.2f\n", (line + server.process_seconds) / elapsed);
+    printf("  received %u  sent %u  rx stalls %u  skipped headers %u  errors %u\n",
+           (unsigned)transport.frames_received, (unsigned)transport.frames_sent,
+           (unsigned)transport.rx_stalls, (unsigned)transport.skipped_headers,
+           (unsigned)transport.errors);
+    if (transport.skipped_headers != (count > BOGUS_BEFORE ? 1u : 0u)) failed = 1;
+    if (transport.errors != (faults ? FAULTS : 0u)) {
+        printf("  expected %u errors\n", faults ? FAULTS : 0u);
+        failed = 1;
+    }
+
+    for (int i = 0; i < count; i++) {
+        free(frames[i].payload);
+        free(frames[i].reply);
+    }
+    free(frames);
+    free(reply);
+    return failed;
+}
@@ -0,0 +1,227 @@
+/*
+ * check_equalization.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "equalization.h"
+
+/*
+ * Checks the HW2 integer equalization table over a corpus of histograms.
+ *     check_equalization [tables] [image.bmp ...]
+ * The corpus is `tables` synthetic histograms (uniform, a few levels, one
+ * dominant level, a narrow band, geometric tails) of sizes from 256 pixels
+ * to UINT32_MAX, plus the 8-bit BMP images given, such as HW2/outputs/.
+ *
+ * - equalize_lut() must equal round(255 * (C - C_min) / (N - C_min)),
+ *   halves up, computed here in 64-bit integers, for every size.
+ * - Up to EQUALIZE_FLOAT_MAX_PIXELS, it may differ from equalize_lut_float()
+ *   only as equalization.h allows: by one level, and only where the exact
+ *   value is within EQUALIZE_FLOAT_TIE_BAND / (1 - C_min / N) of a .5 tie.
+ * Any other difference is printed and makes the exit status 1.
+ */
+#define DEFAULT_TABLES 200000
+#define MAX_REPORTS 10
+
+static const uint32_t sizes[] = {
+    256, 4096, 76800, 307200, 1u << 20, 1u << 22, EQUALIZE_FLOAT_MAX_PIXELS,
+    EQUALIZE_FLOAT_MAX_PIXELS - 7, 1u << 24, 1u << 28, UINT32_MAX
+};
+#define NUM_SIZES (int)(sizeof(sizes) / sizeof(sizes[0]))
+
+typedef struct {
+    long tables;
+    long float_tables;          // within EQUALIZE_FLOAT_MAX_PIXELS
+    long differing_tables;
+    long differing_entries;
+    double worst_band;          // largest tie distance * (1 - C_min / N) seen
+    int reports;
+    int failed;
+} check_stats_t;
+
+static uint32_t seed = 12345;
+
+static uint32_t rnd(void)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+// 1..n pixels, but no more than are left
+static uint32_t take(uint32_t *left, uint32_t n)
+{
+    uint32_t c = 1 + rnd() % n;
+    if (c > *left) c = *left;
+    *left -= c;
+    return c;
+}
+
+static void make_histogram(uint32_t *h, uint32_t total, int kind)
+{
+    uint32_t left = total;
+
+    memset(h, 0, EQUALIZE_LEVELS * sizeof(uint32_t));
+    switch (kind) {
+    case 0:     // roughly uniform
+        for (int r = 0; r < EQUALIZE_LEVELS; r++) h[r] = take(&left, total / 128 + 1);
+        break;
+    case 1:     // a few levels, as in a synthetic or posterized image
+        for (int n = 1 + (int)(rnd() % 6); n > 0 && left; n--) h[rnd() & 0xFF] += take(&left, left);
+        break;
+    case 2: {   // one dominant level, e.g. a dark background
+        uint32_t background = total - total / (2 + rnd() % 1000);
+        h[rnd() & 0xFF] = background;
+        left -= background;
+        while (left) h[rnd() & 0xFF] += take(&left, left / 3 + 1);
+        break;
+    }
+    case 3: {   // a narrow band of levels, a low-contrast image
+        uint32_t lo = rnd() & 0xFF, width = 1 + rnd() % 32;
+        for (uint32_t r = lo; r < EQUALIZE_LEVELS && r < lo + width && left; r++) {
+            h[r] = take(&left, total / width + total / (2 * width) + 1);
+        }
+        break;
+    }
+    default:    // geometric tail towards the bright end
+        for (int r = 0; r < EQUALIZE_LEVELS - 1 && left; r++) {
+            h[r] = (uint32_t)((uint64_t)left * (rnd() % 100) / 2000);
+            left -= h[r];
+        }
+        break;
+    }
+    h[EQUALIZE_LEVELS - 1] += left;
+}
+
+// The table in 64-bit integers, exactly as equalization.h defines it
+static void reference_lut(const uint32_t *h, uint32_t total, uint8_t *lut)
+{
+    int first = 0;
+    while (first < EQUALIZE_LEVELS && h[first] == 0) first++;
+    uint64_t cdf_min = (first < EQUALIZE_LEVELS) ? h[first] : 0;
+    uint64_t den = total - cdf_min, cdf = 0;
+
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        cdf += h[r];
+        lut[r] = (cdf <= cdf_min || den == 0) ? 0 : (uint8_t)((510u * (cdf - cdf_min) + den) / (2 * den));
+    }
+}
+
+static void report(check_stats_t *st, const char *source, const char *what, int r,
+                   int exact_lut, int other, double exact)
+{
+    st->failed = 1;
+    if (st->reports++ < MAX_REPORTS) {
+        printf("  %s: level %d, %s gives %d, exact %.6f (%d)\n", source, r, what, other, exact, exact_lut);
+    }
+}
+
+static void check(check_stats_t *st, const uint32_t *h, uint32_t total, const char *source)
+{
+    uint8_t fixed[EQUALIZE_LEVELS], flt[EQUALIZE_LEVELS], ref[EQUALIZE_LEVELS];
+    int first = 0, differs = 0;
+
+    while (first < EQUALIZE_LEVELS && h[first] == 0) first++;
+    if (first == EQUALIZE_LEVELS) return;
+    double cdf_min = h[first], span = (double)total - cdf_min;
+
+    equalize_lut(h, total, fixed);
+    reference_lut(h, total, ref);
+    st->tables++;
+
+    int check_float = (total <= EQUALIZE_FLOAT_MAX_PIXELS);
+    if (check_float) {
+        equalize_lut_float(h, total, flt);
+        st->float_tables++;
+    }
+
+    double cdf = 0.0;
+    for (int r = 0; r < EQUALIZE_LEVELS; r++) {
+        cdf += h[r];
+        double exact = (span > 0.0 && cdf > cdf_min) ? 255.0 * (cdf - cdf_min) / span : 0.0;
+
+        if (fixed[r] != ref[r]) report(st, source, "equalize_lut", r, ref[r], fixed[r], exact);
+        if (!check_float || flt[r] == fixed[r]) continue;
+
+        double band = fabs(exact - floor(exact) - 0.5) * (1.0 - cdf_min / total);
+        if (band > st->worst_band) st->worst_band = band;
+        if (abs((int)flt[r] - (int)fixed[r]) > 1 || band > EQUALIZE_FLOAT_TIE_BAND) {
+            report(st, source, "equalize_lut_float", r, ref[r], flt[r], exact);
+        }
+        st->differing_entries++;
+        differs = 1;
+    }
+    st->differing_tables += differs;
+}
+
+// 8-bit palette BMP, as in HW2/outputs/; returns 0 or -1
+static int bmp_histogram(const char *path, uint32_t *h, uint32_t *total)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t header[54], palette[256 * 4], *row = NULL;
+    int ok = 0;
+
+    if (!f) return -1;
+    if (fread(header, 1, sizeof(header), f) == sizeof(header) && header[0] == 'B' && header[1] == 'M') {
+        uint32_t offset = header[10] | header[11] << 8 | (uint32_t)header[12] << 16 | (uint32_t)header[13] << 24;
+        int32_t width = header[18] | header[19] << 8 | header[20] << 16 | header[21] << 24;
+        int32_t height = header[22] | header[23] << 8 | header[24] << 16 | header[25] << 24;
+        uint32_t colors = header[46] | header[47] << 8;
+        uint32_t stride = ((uint32_t)width + 3) & ~3u;
+
+        if (height < 0) height = -height;
+        if (colors == 0) colors = 256;
+        if (header[28] == 8 && header[30] == 0 && width > 0 && colors <= 256 &&
+            fread(palette, 4, colors, f) == colors && fseek(f, (long)offset, SEEK_SET) == 0 &&
+            (row = malloc(stride)) != NULL) {
+            memset(h, 0, EQUALIZE_LEVELS * sizeof(uint32_t));
+            ok = 1;
+            for (int32_t y = 0; y < height && ok; y++) {
+                ok = (fread(row, 1, stride, f) == stride);
+                // Gray palettes have B = G = R; take the blue entry
+                for (int32_t x = 0; x < width && ok; x++) h[palette[4 * row[x]]]++;
+            }
+            *total = (uint32_t)width * (uint32_t)height;
+        }
+    }
+    free(row);
+    fclose(f);
+    return ok ? 0 : -1;
+}
+
+int main(int argc, char **argv)
+{
+    long tables = (argc > 1) ? atol(argv[1]) : DEFAULT_TABLES;
+    check_stats_t st = {0};
+    uint32_t h[EQUALIZE_LEVELS], total;
+    char source[48];
+
+    for (int a = 2; a < argc; a++) {
+        if (bmp_histogram(argv[a], h, &total) != 0) {
+            fprintf(stderr, "%s: not an 8-bit BMP\n", argv[a]);
+            return 1;
+        }
+        long before = st.differing_entries;
+        check(&st, h, total, argv[a]);
+        printf("%-28s %u pixels, %ld levels differ from the float table\n", argv[a], total,
+               st.differing_entries - before);
+    }
+
+    for (long t = 0; t < tables; t++) {
+        uint32_t n = sizes[rnd() % NUM_SIZES];
+        int kind = (int)(t % 5);
+        make_histogram(h, n, kind);
+        snprintf(source, sizeof(source), "table %ld (kind %d, N %u)", t, kind, n);
+        check(&st, h, n, source);
+    }
+
+    printf("%ld tables, %ld compared with the float reference\n", st.tables, st.float_tables);
+    printf("  %ld tables and %ld levels differ from it\n", st.differing_tables, st.differing_entries);
+    printf("  widest tie band %.2e (allowed %.2e)\n", st.worst_band, EQUALIZE_FLOAT_TIE_BAND);
+    if (st.failed) printf("  %d entries outside the contract\n", st.reports);
+    return st.failed;
+}
@@ -0,0 +1,247 @@
+/*
+ * check_row_transport.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <poll.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "uart_pty_port.h"
+#include "row_transport.h"
+
+/*
+ * HW2's row streaming on Linux: row_transport.c as the board builds it,
+ * with USART2 replaced by a pseudo-terminal paced at the board's baud rate
+ * (uart_pty_port.c).
+ *     check_row_transport [frames] [baud] [faults]
+ * The server thread is the board's loop from HW2 main.c with the filters
+ * replaced by inverting each row: it reads ROW_HEIGHT rows, sends each one
+ * back, and on a failed read calls row_transport_resync() and waits for
+ * the next frame. The client sends its frames back to back and checks
+ * every reply. If a frame comes back short, it waits and sends the frame
+ * again, as the comment in HW2 main.c asks of the PC.
+ *
+ * With faults set to 1, the port refuses the first receive start and the
+ * first transmit start, and aborts the first reply before its first byte;
+ * none of these loses a byte. Halfway through the second frame it aborts a
+ * receive in the middle of a row, so the rows that follow are misaligned.
+ * That frame must come back short and be sent once more, with exactly one
+ * resync and four errors counted. Any mismatch makes the exit status 1.
+ */
+#define ROW_WIDTH 64
+#define ROW_HEIGHT 32
+#define DEFAULT_FRAMES 8
+#define DEFAULT_BAUD 115200             // USART2 on the board
+#define SERVER_TIMEOUT_MS 500           // STREAM_UART_TIMEOUT_MS
+#define IDLE_MS 50                      // STREAM_UART_IDLE_MS
+#define ABORT_AT_ROW (ROW_HEIGHT + ROW_HEIGHT / 2)
+#define FAULTS 4
+#define MAX_RETRIES 3
+
+typedef struct {
+    row_transport_t *transport;
+    uart_pty_port_t *pty;
+    int faults;
+    atomic_int stop;                    // set once every frame has come back
+    uint32_t rows;                      // rows read
+    uint32_t frames;                    // frames read whole
+    uint32_t resyncs;
+} server_t;
+
+static uint8_t transport_rows[ROW_TRANSPORT_BUFFER_SIZE(ROW_WIDTH)];
+
+static void rx_complete(void *ctx) { row_transport_rx_complete(ctx); }
+static void tx_complete(void *ctx) { row_transport_tx_complete(ctx); }
+
+static void transport_error(void *ctx, uint32_t stopped)
+{
+    row_transport_error(ctx, ((stopped & UART_PTY_ERROR_RX) ? ROW_ERROR_RX : 0) |
+                             ((stopped & UART_PTY_ERROR_TX) ? ROW_ERROR_TX : 0));
+}
+
+static const uart_pty_handlers_t pty_handlers = { rx_complete, tx_complete, transport_error };
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static int write_all(int fd, const uint8_t *buf, uint32_t size)
+{
+    while (size) {
+        ssize_t w = write(fd, buf, size);
+        if (w <= 0) return -1;
+        buf += w;
+        size -= (uint32_t)w;
+    }
+    return 0;
+}
+
+// Returns 0, 1 if nothing arrived for timeout_ms, or -1 if the port closed
+static int read_row(int fd, uint8_t *buf, uint32_t size, int timeout_ms)
+{
+    while (size) {
+        struct pollfd pfd = { fd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, timeout_ms);
+        if (ready == 0) return 1;
+        if (ready < 0) return -1;
+        ssize_t r = read(fd, buf, size);
+        if (r <= 0) return -1;
+        buf += r;
+        size -= (uint32_t)r;
+    }
+    return 0;
+}
+
+// The board's loop (stream_uart_frame() in HW2 main.c), one row at a time
+static void *server_main(void *arg)
+{
+    server_t *s = arg;
+    uint8_t row[ROW_WIDTH];
+
+    while (!atomic_load(&s->stop)) {
+        uint32_t y;
+        for (y = 0; y < ROW_HEIGHT; y++) {
+            if (row_transport_read(s->transport, row, SERVER_TIMEOUT_MS) != 0) break;
+            if (++s->rows == ABORT_AT_ROW && s->faults) {
+                // The next receive stops halfway through its row
+                pthread_mutex_lock(&s->pty->mutex);
+                s->pty->abort_rx = 1;
+                s->pty->abort_rx_after = ROW_WIDTH / 2;
+                pthread_mutex_unlock(&s->pty->mutex);
+            }
+            for (uint32_t x = 0; x < ROW_WIDTH; x++) row[x] ^= 0xFF;
+            row_transport_write(s->transport, row);
+        }
+        if (y == ROW_HEIGHT) {
+            s->frames++;
+        } else if (!atomic_load(&s->stop)) {
+            s->resyncs++;
+            row_transport_resync(s->transport, IDLE_MS);
+        }
+    }
+    return NULL;
+}
+
+int main(int argc, char **argv)
+{
+    int count = (argc > 1) ? atoi(argv[1]) : DEFAULT_FRAMES;
+    uint32_t baud = (argc > 2) ? (uint32_t)atoi(argv[2]) : DEFAULT_BAUD;
+    int faults = (argc > 3) ? atoi(argv[3]) : 0;
+    const uint32_t frame_size = ROW_WIDTH * ROW_HEIGHT;
+    uint32_t seed = 12345;
+    int failed = 0, resent = 0;
+
+    if (count < 1) count = 1;
+    if (faults && count < 2) count = 2;
+    uint8_t *frames = malloc((size_t)count * frame_size);
+    if (!frames) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+    for (uint32_t i = 0; i < (uint32_t)count * frame_size; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        frames[i] = (uint8_t)(seed >> 24);
+    }
+
+    uart_pty_port_t pty;
+    row_transport_t transport;
+    int fd;
+
+    if (uart_pty_open(&pty, baud, &fd) != 0) {
+        perror("pty");
+        return 1;
+    }
+    const row_port_t port = {
+        uart_pty_start_receive, uart_pty_start_transmit, uart_pty_abort_receive,
+        uart_pty_lock, uart_pty_unlock, uart_pty_wait, uart_pty_millis, &pty
+    };
+    row_transport_init(&transport, &port, ROW_WIDTH, transport_rows);
+    if (uart_pty_start(&pty, &pty_handlers, &transport) != 0) {
+        perror("pthread_create");
+        return 1;
+    }
+    if (faults) {
+        pthread_mutex_lock(&pty.mutex);
+        pty.fail_rx_starts = 1;
+        pty.fail_tx_starts = 1;
+        pty.abort_tx = 1;
+        pthread_mutex_unlock(&pty.mutex);
+    }
+
+    server_t server = { &transport, &pty, faults, 0, 0, 0, 0 };
+    pthread_t server_thread;
+    // Long enough for the rest of a broken frame to arrive and the board to see the line idle
+    int reply_timeout_ms = (int)((baud ? frame_size * 10000u / baud : 0) + 3 * IDLE_MS + 100);
+
+    double start = now();
+    row_transport_start(&transport);
+    pthread_create(&server_thread, NULL, server_main, &server);
+
+    for (int i = 0; i < count && !failed; i++) {
+        const uint8_t *frame = frames + (size_t)i * frame_size;
+        for (int attempt = 0;; attempt++) {
+            if (attempt > MAX_RETRIES) {
+                printf("  frame %d did not come back whole\n", i);
+                failed = 1;
+                break;
+            }
+            if (write_all(fd, frame, frame_size) != 0) {
+                fprintf(stderr, "connection lost at frame %d\n", i);
+                return 1;
+            }
+            uint32_t y;
+            for (y = 0; y < ROW_HEIGHT; y++) {
+                uint8_t reply[ROW_WIDTH];
+                int status = read_row(fd, reply, ROW_WIDTH, reply_timeout_ms);
+                if (status < 0) {
+                    fprintf(stderr, "connection lost at frame %d\n", i);
+                    return 1;
+                }
+                if (status > 0) break;
+                for (uint32_t x = 0; x < ROW_WIDTH; x++) {
+                    uint8_t expected = frame[y * ROW_WIDTH + x] ^ 0xFF;
+                    if (reply[x] != expected) {
+                        printf("  MISMATCH in frame %d, row %u\n", i, (unsigned)y);
+                        failed = 1;
+                        break;
+                    }
+                }
+            }
+            if (y == ROW_HEIGHT) break;
+            printf("  frame %d came back with %u rows; sending it again\n", i, (unsigned)y);
+            resent++;
+        }
+    }
+    double elapsed = now() - start;
+    atomic_store(&server.stop, 1);
+
+    pthread_join(server_thread, NULL);
+    row_transport_stop(&transport);
+    close(fd);
+    uart_pty_close(&pty);
+
+    double line = (baud) ? (double)(count + resent) * frame_size * 10.0 / baud : 0.0;
+    printf("%d frames of %u x %u at %u baud\n", count, ROW_WIDTH, ROW_HEIGHT, baud);
+    printf("  elapsed %.3f s  (line %.3f s each way)\n", elapsed, line);
+    printf("  frames %u  resent %d  resyncs %u  rx stalls %u  errors %u\n",
+           (unsigned)server.frames, resent, (unsigned)server.resyncs,
+           (unsigned)transport.rx_stalls, (unsigned)transport.errors);
+    if (transport.errors != (faults ? FAULTS : 0u) ||
+        server.resyncs != (faults ? 1u : 0u) || resent != (faults ? 1 : 0)) {
+        printf("  expected %u errors, %u resyncs and %u resent frames\n",
+               faults ? FAULTS : 0u, faults ? 1u : 0u, faults ? 1u : 0u);
+        failed = 1;
+    }
+
+    free(frames);
+    return failed;
+}
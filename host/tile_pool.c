@@ -0,0 +1,163 @@
+/*
+ * tile_pool.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <sched.h>
+#include "tile_pool.h"
+
+// Takes the last task of the worker's own block
+static int pop_own(tile_deque_t *d, uint32_t *task)
+{
+    int found = 0;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->begin < d->end) {
+        *task = --d->end;
+        found = 1;
+    }
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+// Moves the front half (at least one task) of a victim's block to the thief
+static int steal(tile_pool_t *pool, int thief)
+{
+    for (int i = 1; i < pool->threads; i++) {
+        tile_deque_t *victim = &pool->deques[(thief + i) % pool->threads];
+        uint32_t begin = 0, end = 0;
+
+        pthread_mutex_lock(&victim->lock);
+        if (victim->begin < victim->end) {
+            uint32_t half = (victim->end - victim->begin + 1) / 2;
+            begin = victim->begin;
+            end = begin + half;
+            victim->begin = end;
+        }
+        pthread_mutex_unlock(&victim->lock);
+
+        if (begin < end) {
+            tile_deque_t *own = &pool->deques[thief];
+            pthread_mutex_lock(&own->lock);
+            own->begin = begin;
+            own->end = end;
+            pthread_mutex_unlock(&own->lock);
+            atomic_fetch_add(&pool->steals, 1);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static void work(tile_pool_t *pool, int worker)
+{
+    while (atomic_load(&pool->remaining) > 0) {
+        uint32_t task;
+
+        if (pop_own(&pool->deques[worker], &task)) {
+            pool->task(pool->ctx, task, worker);
+            atomic_fetch_sub(&pool->remaining, 1);
+        } else if (!steal(pool, worker)) {
+            // Everything left is running on other workers
+            sched_yield();
+        }
+    }
+}
+
+static void *worker_main(void *arg)
+{
+    tile_worker_t *w = arg;
+    tile_pool_t *pool = w->pool;
+    uint32_t seen = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    for (;;) {
+        while (!pool->quit && pool->generation == seen) {
+            pthread_cond_wait(&pool->start, &pool->lock);
+        }
+        if (pool->quit) break;
+        seen = pool->generation;
+        pthread_mutex_unlock(&pool->lock);
+
+        work(pool, w->index);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->busy == 0) pthread_cond_signal(&pool->done);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+int tile_pool_init(tile_pool_t *pool, int threads)
+{
+    if (threads < 1) threads = 1;
+    if (threads > TILE_POOL_MAX_THREADS) threads = TILE_POOL_MAX_THREADS;
+
+    pool->threads = threads;
+    pool->generation = 0;
+    pool->busy = 0;
+    pool->quit = 0;
+    atomic_init(&pool->remaining, 0);
+    atomic_init(&pool->steals, 0);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->start, NULL);
+    pthread_cond_init(&pool->done, NULL);
+    for (int w = 0; w < threads; w++) {
+        pthread_mutex_init(&pool->deques[w].lock, NULL);
+        pool->deques[w].begin = pool->deques[w].end = 0;
+    }
+
+    for (int w = 1; w < threads; w++) {
+        pool->workers[w].pool = pool;
+        pool->workers[w].index = w;
+        if (pthread_create(&pool->handles[w], NULL, worker_main, &pool->workers[w]) != 0) {
+            pool->threads = w;
+            tile_pool_destroy(pool);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void tile_pool_destroy(tile_pool_t *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->quit = 1;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    for (int w = 1; w < pool->threads; w++) pthread_join(pool->handles[w], NULL);
+    for (int w = 0; w < pool->threads; w++) pthread_mutex_destroy(&pool->deques[w].lock);
+    pthread_cond_destroy(&pool->done);
+    pthread_cond_destroy(&pool->start);
+    pthread_mutex_destroy(&pool->lock);
+}
+
+void tile_pool_run(tile_pool_t *pool, uint32_t count, tile_task_t task, void *ctx)
+{
+    if (count == 0) return;
+
+    // Contiguous blocks, so neighbouring tiles stay on one core
+    for (int w = 0; w < pool->threads; w++) {
+        pool->deques[w].begin = (uint32_t)((uint64_t)count * w / pool->threads);
+        pool->deques[w].end = (uint32_t)((uint64_t)count * (w + 1) / pool->threads);
+    }
+    pool->task = task;
+    pool->ctx = ctx;
+    atomic_store(&pool->remaining, count);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->busy = pool->threads - 1;
+    pool->generation++;
+    pthread_cond_broadcast(&pool->start);
+    pthread_mutex_unlock(&pool->lock);
+
+    work(pool, 0);
+
+    // Helpers may still be returning from their last task or steal attempt
+    pthread_mutex_lock(&pool->lock);
+    while (pool->busy > 0) pthread_cond_wait(&pool->done, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+}
@@ -0,0 +1,67 @@
+/*
+ * tile_pool.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef TILE_POOL_H_
+#define TILE_POOL_H_
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+
+#define TILE_POOL_MAX_THREADS 64
+
+/*
+ * Work-stealing thread pool for host builds. A job is `count` independent
+ * tasks numbered 0 .. count - 1. Each worker starts with a contiguous block
+ * of them as its own deque, takes tasks from the back of it, and when it
+ * runs dry steals the front half of another worker's remaining block, so
+ * uneven tiles (e.g. a median over a flat and a noisy region) still keep
+ * every core busy. The calling thread is worker 0.
+ */
+typedef void (*tile_task_t)(void *ctx, uint32_t task, int worker);
+
+typedef struct {
+    pthread_mutex_t lock;
+    uint32_t begin;     // next task a thief takes
+    uint32_t end;       // one past the next task the owner takes
+} tile_deque_t;
+
+typedef struct tile_pool tile_pool_t;
+
+typedef struct {
+    tile_pool_t *pool;
+    int index;
+} tile_worker_t;
+
+struct tile_pool {
+    int threads;
+    pthread_t handles[TILE_POOL_MAX_THREADS];
+    tile_worker_t workers[TILE_POOL_MAX_THREADS];  // helper thread arguments
+    tile_deque_t deques[TILE_POOL_MAX_THREADS];
+
+    // Current job, published under lock with a new generation
+    pthread_mutex_t lock;
+    pthread_cond_t start;
+    pthread_cond_t done;
+    uint32_t generation;
+    int busy;                   // helper threads still inside the job
+    int quit;
+    tile_task_t task;
+    void *ctx;
+    atomic_uint remaining;      // tasks not finished yet
+
+    atomic_uint steals;         // totals over all jobs
+};
+
+// Starts threads - 1 helper threads; returns 0, or -1 on failure
+int tile_pool_init(tile_pool_t *pool, int threads);
+void tile_pool_destroy(tile_pool_t *pool);
+
+// Runs task(ctx, i, worker) for every i < count and returns when all are done
+void tile_pool_run(tile_pool_t *pool, uint32_t count, tile_task_t task, void *ctx);
+
+#endif /* TILE_POOL_H_ */
@@ -0,0 +1,92 @@
+/*
+ * tiled_filters.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "tiled_filters.h"
+#include "spatial_filters.h"
+#include "morphology.h"
+
+typedef struct {
+    const tiled_filter_t *f;
+    const image_view_t *src;
+    const image_view_t *dst;
+    int tile_size;
+    int tiles_x;
+    int radius;
+    uint8_t *scratch;           // one (tile_size + 2 * radius)^2 buffer per worker
+    uint32_t scratch_size;
+} tiled_job_t;
+
+static void run_tile(void *ctx, uint32_t task, int worker)
+{
+    const tiled_job_t *job = ctx;
+    const image_view_t *src = job->src;
+    int r = job->radius;
+
+    // The tile, and the tile plus its halo clipped to the frame
+    int x0 = (int)(task % job->tiles_x) * job->tile_size;
+    int y0 = (int)(task / job->tiles_x) * job->tile_size;
+    int x1 = (x0 + job->tile_size < src->width) ? x0 + job->tile_size : src->width;
+    int y1 = (y0 + job->tile_size < src->height) ? y0 + job->tile_size : src->height;
+    int hx0 = (x0 > r) ? x0 - r : 0;
+    int hy0 = (y0 > r) ? y0 - r : 0;
+    int hx1 = (x1 + r < src->width) ? x1 + r : src->width;
+    int hy1 = (y1 + r < src->height) ? y1 + r : src->height;
+
+    image_view_t in = image_view_roi(src, hx0, hy0, hx1 - hx0, hy1 - hy0);
+    image_view_t out = image_view_make(job->scratch + (size_t)worker * job->scratch_size,
+                                       in.width, in.height, PIXEL_U8);
+
+    switch (job->f->op) {
+    case TILED_CONVOLUTION:
+        apply_2d_convolution(&in, &out, job->f->kernel, job->f->kernel_size);
+        break;
+    case TILED_MEDIAN:
+        apply_median_filtering(&in, &out, job->f->kernel_size);
+        break;
+    case TILED_DILATION:
+    case TILED_EROSION:
+        if (job->f->op == TILED_DILATION) morph_dilation(&in, &out);
+        else morph_erosion(&in, &out);
+        // The frame's outer pixels are not written on the whole frame either
+        if (x0 == 0) x0 = 1;
+        if (y0 == 0) y0 = 1;
+        if (x1 == src->width) x1 = src->width - 1;
+        if (y1 == src->height) y1 = src->height - 1;
+        break;
+    }
+    if (x1 <= x0) return;
+
+    for (int y = y0; y < y1; y++) {
+        memcpy(IMAGE_VIEW_ROW_U8(job->dst, y) + x0,
+               IMAGE_VIEW_ROW_U8(&out, y - hy0) + (x0 - hx0), (size_t)(x1 - x0));
+    }
+}
+
+int tiled_filter_run(tile_pool_t *pool, const tiled_filter_t *f,
+                     const image_view_t *src, const image_view_t *dst, int tile_size)
+{
+    tiled_job_t job;
+
+    job.f = f;
+    job.src = src;
+    job.dst = dst;
+    job.tile_size = (tile_size > 0) ? tile_size : TILED_DEFAULT_TILE;
+    job.radius = (f->op == TILED_CONVOLUTION || f->op == TILED_MEDIAN) ? f->kernel_size / 2 : 1;
+    job.tiles_x = (src->width + job.tile_size - 1) / job.tile_size;
+
+    int tiles_y = (src->height + job.tile_size - 1) / job.tile_size;
+    uint32_t side = (uint32_t)job.tile_size + 2 * job.radius;
+    job.scratch_size = side * side;
+    job.scratch = malloc((size_t)job.scratch_size * pool->threads);
+    if (!job.scratch) return -1;
+
+    tile_pool_run(pool, (uint32_t)(job.tiles_x * tiles_y), run_tile, &job);
+    free(job.scratch);
+    return 0;
+}
@@ -0,0 +1,44 @@
+/*
+ * tiled_filters.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef TILED_FILTERS_H_
+#define TILED_FILTERS_H_
+
+#include <stdint.h>
+#include "image_view.h"
+#include "tile_pool.h"
+
+/*
+ * Host backend for the HW2 convolution and median and the HW3 morphology.
+ * A frame is cut into tile_size x tile_size tiles. Each tile's source is a
+ * view of the tile grown by the kernel radius (the halo, clipped at the
+ * frame edges), so the unchanged single-threaded kernel sees the same
+ * neighbours as on the whole frame. The result goes to a per-worker scratch
+ * buffer and only the tile itself is copied to dst, so tiles never write
+ * each other's pixels. The tiles are scheduled on a tile_pool_t, and the
+ * output is byte-identical to calling the kernel on the whole frame.
+ */
+#define TILED_DEFAULT_TILE 256
+
+typedef enum {
+    TILED_CONVOLUTION,      // apply_2d_convolution()
+    TILED_MEDIAN,           // apply_median_filtering()
+    TILED_DILATION,         // morph_dilation(), 3x3
+    TILED_EROSION           // morph_erosion(), 3x3
+} tiled_op_t;
+
+typedef struct {
+    tiled_op_t op;
+    const float *kernel;    // TILED_CONVOLUTION only
+    int kernel_size;        // convolution and median
+} tiled_filter_t;
+
+// 8-bit src and dst of the same size; returns 0, or -1 if scratch allocation fails
+int tiled_filter_run(tile_pool_t *pool, const tiled_filter_t *f,
+                     const image_view_t *src, const image_view_t *dst, int tile_size);
+
+#endif /* TILED_FILTERS_H_ */
@@ -0,0 +1,279 @@
+/*
+ * uart_pty_port.c
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include "uart_pty_port.h"
+
+// Bytes moved per read or write, so a slow baud rate is paced smoothly
+#define PTY_CHUNK 256
+// How often a receive waiting for bytes checks for an abort or stop
+#define PTY_POLL_MS 5
+
+static double now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Sleeps until `done` bytes are due at the port's baud rate since `start`
+static void pace(const uart_pty_port_t *p, double start, uint32_t done)
+{
+    if (p->baud == 0) return;
+    double due = start + (double)done * 10.0 / p->baud;
+    double wait = due - now();
+    if (wait > 0) {
+        struct timespec t = { (time_t)wait, (long)((wait - (time_t)wait) * 1e9) };
+        nanosleep(&t, NULL);
+    }
+}
+
+int uart_pty_start_receive(void *ctx, uint8_t *buf, uint32_t size)
+{
+    uart_pty_port_t *p = ctx;
+    if (p->rx_buf) return -1;           // busy, like HAL_BUSY
+    if (p->fail_rx_starts > 0) {
+        p->fail_rx_starts--;
+        return -1;
+    }
+    p->rx_buf = buf;
+    p->rx_size = size;
+    pthread_cond_broadcast(&p->request);
+    return 0;
+}
+
+int uart_pty_start_transmit(void *ctx, const uint8_t *buf, uint32_t size)
+{
+    uart_pty_port_t *p = ctx;
+    if (p->tx_buf) return -1;
+    if (p->fail_tx_starts > 0) {
+        p->fail_tx_starts--;
+        return -1;
+    }
+    p->tx_buf = buf;
+    p->tx_size = size;
+    pthread_cond_broadcast(&p->request);
+    return 0;
+}
+
+// Called without the mutex, as HAL_UART_AbortReceive() runs outside the lock
+void uart_pty_abort_receive(void *ctx)
+{
+    uart_pty_port_t *p = ctx;
+
+    pthread_mutex_lock(&p->mutex);
+    if (p->rx_buf) {
+        p->rx_cancel = 1;
+        pthread_cond_broadcast(&p->request);
+        while (p->rx_buf) pthread_cond_wait(&p->event, &p->mutex);
+        p->rx_cancel = 0;
+    }
+    pthread_mutex_unlock(&p->mutex);
+}
+
+void uart_pty_lock(void *ctx)
+{
+    pthread_mutex_lock(&((uart_pty_port_t *)ctx)->mutex);
+}
+
+void uart_pty_unlock(void *ctx)
+{
+    pthread_mutex_unlock(&((uart_pty_port_t *)ctx)->mutex);
+}
+
+// Called with the mutex held, as __WFI() runs with interrupts masked. The
+// timeout plays the SysTick, so callers can check a deadline or stop flag.
+void uart_pty_wait(void *ctx)
+{
+    uart_pty_port_t *p = ctx;
+    struct timespec t;
+
+    clock_gettime(CLOCK_REALTIME, &t);
+    t.tv_nsec += 10 * 1000 * 1000;
+    if (t.tv_nsec >= 1000000000L) {
+        t.tv_sec++;
+        t.tv_nsec -= 1000000000L;
+    }
+    pthread_cond_timedwait(&p->event, &p->mutex, &t);
+}
+
+uint32_t uart_pty_millis(void *ctx)
+{
+    (void)ctx;
+    return (uint32_t)(uint64_t)(now() * 1000.0);
+}
+
+static int rx_cancelled(uart_pty_port_t *p)
+{
+    pthread_mutex_lock(&p->mutex);
+    int cancel = p->rx_cancel || p->stop;
+    pthread_mutex_unlock(&p->mutex);
+    return cancel;
+}
+
+/* Reads size bytes into buf. Returns 0, 1 if the receive was aborted or the
+ * port stopped, or -1 if the client closed its side. */
+static int receive_bytes(uart_pty_port_t *p, uint8_t *buf, uint32_t size)
+{
+    double start = now();
+    uint32_t done = 0;
+
+    while (done < size) {
+        struct pollfd pfd = { p->fd, POLLIN, 0 };
+        int ready = poll(&pfd, 1, PTY_POLL_MS);
+        if (rx_cancelled(p)) return 1;
+        if (ready < 0 && errno != EINTR) return -1;
+        if (ready <= 0) continue;
+
+        uint32_t n = (size - done < PTY_CHUNK) ? size - done : PTY_CHUNK;
+        ssize_t r = read(p->fd, buf + done, n);
+        if (r <= 0) {
+            if (r < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+            return -1;
+        }
+        done += (uint32_t)r;
+        pace(p, start, done);
+    }
+    return 0;
+}
+
+static void *rx_main(void *arg)
+{
+    uart_pty_port_t *p = arg;
+
+    pthread_mutex_lock(&p->mutex);
+    for (;;) {
+        while (!p->stop && !p->rx_buf) pthread_cond_wait(&p->request, &p->mutex);
+        if (p->stop) break;
+        uint8_t *buf = p->rx_buf;
+        uint32_t size = p->rx_size;
+        int abort = 0;
+        if (p->abort_rx > 0) {
+            p->abort_rx--;
+            abort = 1;
+            if (p->abort_rx_after < size) size = p->abort_rx_after;
+        }
+        pthread_mutex_unlock(&p->mutex);
+
+        int status = receive_bytes(p, buf, size);
+
+        pthread_mutex_lock(&p->mutex);
+        if (status < 0) break;          // client closed its side
+        p->rx_buf = NULL;
+        if (status > 0) {
+            // Aborted: no callback, as with HAL_UART_AbortReceive()
+        } else if (abort) {
+            p->handlers->error(p->transport, UART_PTY_ERROR_RX);
+        } else {
+            p->handlers->rx_complete(p->transport);
+        }
+        pthread_cond_broadcast(&p->event);
+    }
+    pthread_mutex_unlock(&p->mutex);
+    return NULL;
+}
+
+static void *tx_main(void *arg)
+{
+    uart_pty_port_t *p = arg;
+
+    pthread_mutex_lock(&p->mutex);
+    for (;;) {
+        while (!p->stop && !p->tx_buf) pthread_cond_wait(&p->request, &p->mutex);
+        if (p->stop) break;
+        if (p->abort_tx > 0) {
+            p->abort_tx--;
+            p->tx_buf = NULL;
+            p->handlers->error(p->transport, UART_PTY_ERROR_TX);
+            pthread_cond_broadcast(&p->event);
+            continue;
+        }
+        const uint8_t *buf = p->tx_buf;
+        uint32_t size = p->tx_size;
+        pthread_mutex_unlock(&p->mutex);
+
+        double start = now();
+        uint32_t done = 0;
+        while (done < size) {
+            uint32_t n = (size - done < PTY_CHUNK) ? size - done : PTY_CHUNK;
+            ssize_t w = write(p->fd, buf + done, n);
+            if (w <= 0) {
+                if (w < 0 && errno == EINTR) continue;
+                pthread_mutex_lock(&p->mutex);
+                goto out;
+            }
+            done += (uint32_t)w;
+            pace(p, start, done);
+        }
+
+        pthread_mutex_lock(&p->mutex);
+        p->tx_buf = NULL;
+        p->handlers->tx_complete(p->transport);
+        pthread_cond_broadcast(&p->event);
+    }
+out:
+    pthread_mutex_unlock(&p->mutex);
+    return NULL;
+}
+
+int uart_pty_open(uart_pty_port_t *p, uint32_t baud, int *client_fd)
+{
+    struct termios tio;
+
+    p->fd = posix_openpt(O_RDWR | O_NOCTTY);
+    if (p->fd < 0 || grantpt(p->fd) != 0 || unlockpt(p->fd) != 0) return -1;
+    *client_fd = open(ptsname(p->fd), O_RDWR | O_NOCTTY);
+    if (*client_fd < 0) return -1;
+
+    // Raw bytes in both directions: no echo, no line editing, no CR/LF mapping
+    if (tcgetattr(*client_fd, &tio) != 0) return -1;
+    cfmakeraw(&tio);
+    if (tcsetattr(*client_fd, TCSANOW, &tio) != 0) return -1;
+
+    p->baud = baud;
+    p->rx_buf = NULL;
+    p->tx_buf = NULL;
+    p->rx_cancel = 0;
+    p->stop = 0;
+    p->fail_rx_starts = p->fail_tx_starts = 0;
+    p->abort_rx = p->abort_tx = 0;
+    p->abort_rx_after = 0;
+    pthread_mutex_init(&p->mutex, NULL);
+    pthread_cond_init(&p->event, NULL);
+    pthread_cond_init(&p->request, NULL);
+    return 0;
+}
+
+int uart_pty_start(uart_pty_port_t *p, const uart_pty_handlers_t *handlers, void *transport)
+{
+    p->handlers = handlers;
+    p->transport = transport;
+    if (pthread_create(&p->rx_thread, NULL, rx_main, p) != 0) return -1;
+    if (pthread_create(&p->tx_thread, NULL, tx_main, p) != 0) return -1;
+    return 0;
+}
+
+void uart_pty_close(uart_pty_port_t *p)
+{
+    pthread_mutex_lock(&p->mutex);
+    p->stop = 1;
+    pthread_cond_broadcast(&p->request);
+    pthread_mutex_unlock(&p->mutex);
+    // A transmit blocked in write() returns once the client has read or closed its side
+    pthread_join(p->rx_thread, NULL);
+    pthread_join(p->tx_thread, NULL);
+    close(p->fd);
+    pthread_mutex_destroy(&p->mutex);
+    pthread_cond_destroy(&p->event);
+    pthread_cond_destroy(&p->request);
+}
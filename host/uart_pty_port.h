@@ -0,0 +1,86 @@
+/*
+ * uart_pty_port.h
+ *
+ *  Created on: Oct 17, 2026
+ *      Author: yesin
+ */
+
+#ifndef UART_PTY_PORT_H_
+#define UART_PTY_PORT_H_
+
+#include <pthread.h>
+#include <stdint.h>
+
+/*
+ * Linux stand-in for the board UARTs: the port callbacks of HW3's
+ * frame_transport.c and HW2's row_transport.c, on the master side of a
+ * pseudo-terminal. A receive thread and a transmit thread play the DMA or
+ * interrupt transfers. Each one moves the requested number of bytes through
+ * the pty, paced at `baud` (10 bits per byte) so transfers take as long as
+ * on the board, then calls the transport's rx_complete or tx_complete with
+ * the port's mutex held, as an interrupt would run with the main loop's
+ * lock excluded. uart_pty_lock() and _unlock() take that mutex.
+ * uart_pty_wait() is called with it held and sleeps until a callback has
+ * run, so an event between the caller's check and the wait is not missed.
+ * uart_pty_abort_receive() returns once the receive thread has let go of
+ * the buffer, as HAL_UART_AbortReceive() does; the bytes it read are lost.
+ *
+ * The fault counters exercise the transports' error paths. While one is
+ * non-zero, the next start call is refused as HAL_BUSY would be, or the
+ * next transfer stops after abort_rx_after bytes (0 for a transmit) and
+ * reports error() as a DMA or UART error interrupt would. Each fault
+ * decrements its counter. Set them with the mutex held.
+ */
+#define UART_PTY_ERROR_RX 0x1u
+#define UART_PTY_ERROR_TX 0x2u
+
+// The transport's interrupt side; ctx is the transport given to uart_pty_start()
+typedef struct {
+    void (*rx_complete)(void *ctx);
+    void (*tx_complete)(void *ctx);
+    void (*error)(void *ctx, uint32_t stopped);     // UART_PTY_ERROR_*
+} uart_pty_handlers_t;
+
+typedef struct {
+    int fd;                         // pty master
+    uint32_t baud;                  // 0: as fast as the pty goes
+    const uart_pty_handlers_t *handlers;
+    void *transport;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t event;           // a transfer completed or was aborted
+    pthread_cond_t request;         // a transfer was started
+    pthread_t rx_thread;
+    pthread_t tx_thread;
+    uint8_t *rx_buf;                // pending requests, NULL when idle
+    uint32_t rx_size;
+    const uint8_t *tx_buf;
+    uint32_t tx_size;
+    int rx_cancel;                  // uart_pty_abort_receive() is waiting
+    int stop;
+    int fail_rx_starts;             // fault injection, see above
+    int fail_tx_starts;
+    int abort_rx;
+    uint32_t abort_rx_after;
+    int abort_tx;
+} uart_pty_port_t;
+
+// Opens a pty pair in raw mode; *client_fd is the slave side. Returns 0 or -1.
+int uart_pty_open(uart_pty_port_t *p, uint32_t baud, int *client_fd);
+
+// Starts the transfer threads, which report to handlers with transport as ctx
+int uart_pty_start(uart_pty_port_t *p, const uart_pty_handlers_t *handlers, void *transport);
+
+// Stops the threads and closes the master side
+void uart_pty_close(uart_pty_port_t *p);
+
+// Port callbacks; ctx is the uart_pty_port_t
+int uart_pty_start_receive(void *ctx, uint8_t *buf, uint32_t size);
+int uart_pty_start_transmit(void *ctx, const uint8_t *buf, uint32_t size);
+void uart_pty_abort_receive(void *ctx);
+void uart_pty_lock(void *ctx);
+void uart_pty_unlock(void *ctx);
+void uart_pty_wait(void *ctx);
+uint32_t uart_pty_millis(void *ctx);
+
+#endif /* UART_PTY_PORT_H_ */